@@ -0,0 +1,354 @@
+/* See LICENSE file for copyright and license details.
+ *
+ * path_bench: times the PATH scanning and caches of path.c over a synthetic
+ * tree in a temporary directory, and counts the system calls they make.
+ * Built and run by "make bench"; the calls are counted by wrapping them at
+ * link time with -Wl,--wrap, so calls libc makes internally, such as the
+ * open() inside fopen(), are not seen.  The page cache is warm throughout, so
+ * "cold" means without a cache slot, not without the inodes in memory.
+ */
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include "bincache.h"
+#include "path.h"
+
+#define LENGTH(X)  (sizeof X / sizeof X[0])
+#define NDIRS      36      /* plain directories in PATH */
+#define PERDIR     2500    /* entries in each */
+#define OVERLAP    625     /* names each directory shares with the next */
+#define NLINKS     10000   /* entries in the symlink farm */
+#define NDANGLING  100     /* of which point nowhere */
+#define REPS       5
+
+enum { Getdents, RingSetup, RingEnter, RingStatx, Syscall, Open, Close, Fstatat,
+       Stat, Access, Read, Mmap, Munmap, Mkdir, Mkstemp, Rename, Unlink, Utimensat,
+       Fopen, Opendir, CountLast };
+
+typedef struct {
+	const char *name;
+	void (*setup)(void);
+	void (*run)(void);
+} Phase;
+
+static void cached(void);
+static void cold(void);
+static void count(int c, unsigned long n);
+static void incremental(void);
+static void mapped(void);
+static void mktree(void);
+static double now(void);
+static void prepcold(void);
+static void prepincremental(void);
+static void prepnothing(void);
+static void rmtree(const char *path);
+
+static const char *countnames[CountLast] = {
+	"getdents64", "io_uring_setup", "io_uring_enter", "statx(ring)", "syscall",
+	"open", "close", "fstatat", "stat", "access", "read", "mmap", "munmap",
+	"mkdir", "mkstemp", "rename", "unlink", "utimensat", "fopen", "opendir",
+};
+static unsigned long counts[CountLast];
+static char root[] = "/tmp/dmenu-bench.XXXXXX";
+static unsigned int added = 0;
+static size_t listed;
+
+static Phase phases[] = {
+	/* name          setup            run */
+	{ "cold",        prepcold,        cold },
+	{ "incremental", prepincremental, incremental },
+	{ "cached",      prepnothing,     cached },
+	{ "mapped",      prepnothing,     mapped },
+};
+
+/* the wrapped calls */
+long __real_syscall(long n, ...);
+int __real_open(const char *path, int flags, ...);
+int __real_close(int fd);
+int __real_fstatat(int dirfd, const char *path, struct stat *st, int flags);
+int __real_stat(const char *path, struct stat *st);
+int __real_access(const char *path, int mode);
+ssize_t __real_read(int fd, void *buf, size_t n);
+void *__real_mmap(void *addr, size_t n, int prot, int flags, int fd, off_t off);
+int __real_munmap(void *addr, size_t n);
+int __real_mkdir(const char *path, mode_t mode);
+int __real_mkstemp(char *tmpl);
+int __real_rename(const char *from, const char *to);
+int __real_unlink(const char *path);
+int __real_utimensat(int dirfd, const char *path, const struct timespec ts[2], int flags);
+FILE *__real_fopen(const char *path, const char *mode);
+void *__real_opendir(const char *path);
+
+long
+__wrap_syscall(long n, ...) {
+	long a[6];
+	va_list ap;
+	size_t i;
+
+	va_start(ap, n);
+	for(i = 0; i < LENGTH(a); i++)
+		a[i] = va_arg(ap, long);
+	va_end(ap);
+	switch(n) {
+	case SYS_getdents64:     count(Getdents, 1); break;
+	case SYS_io_uring_setup: count(RingSetup, 1); break;
+	case SYS_io_uring_enter: count(RingEnter, 1); count(RingStatx, a[1]); break;
+	default:                 count(Syscall, 1); break;
+	}
+	return __real_syscall(n, a[0], a[1], a[2], a[3], a[4], a[5]);
+}
+
+int
+__wrap_open(const char *path, int flags, ...) {
+	mode_t mode = 0;
+	va_list ap;
+
+	if(flags & O_CREAT) {
+		va_start(ap, flags);
+		mode = va_arg(ap, mode_t);
+		va_end(ap);
+	}
+	count(Open, 1);
+	return __real_open(path, flags, mode);
+}
+
+int __wrap_close(int fd) { count(Close, 1); return __real_close(fd); }
+int __wrap_fstatat(int dirfd, const char *path, struct stat *st, int flags) { count(Fstatat, 1); return __real_fstatat(dirfd, path, st, flags); }
+int __wrap_stat(const char *path, struct stat *st) { count(Stat, 1); return __real_stat(path, st); }
+int __wrap_access(const char *path, int mode) { count(Access, 1); return __real_access(path, mode); }
+ssize_t __wrap_read(int fd, void *buf, size_t n) { count(Read, 1); return __real_read(fd, buf, n); }
+void *__wrap_mmap(void *addr, size_t n, int prot, int flags, int fd, off_t off) { count(Mmap, 1); return __real_mmap(addr, n, prot, flags, fd, off); }
+int __wrap_munmap(void *addr, size_t n) { count(Munmap, 1); return __real_munmap(addr, n); }
+int __wrap_mkdir(const char *path, mode_t mode) { count(Mkdir, 1); return __real_mkdir(path, mode); }
+int __wrap_mkstemp(char *tmpl) { count(Mkstemp, 1); return __real_mkstemp(tmpl); }
+int __wrap_rename(const char *from, const char *to) { count(Rename, 1); return __real_rename(from, to); }
+int __wrap_unlink(const char *path) { count(Unlink, 1); return __real_unlink(path); }
+int __wrap_utimensat(int dirfd, const char *path, const struct timespec ts[2], int flags) { count(Utimensat, 1); return __real_utimensat(dirfd, path, ts, flags); }
+FILE *__wrap_fopen(const char *path, const char *mode) { count(Fopen, 1); return __real_fopen(path, mode); }
+void *__wrap_opendir(const char *path) { count(Opendir, 1); return __real_opendir(path); }
+
+int
+main(void) {
+	char buf[BUFSIZ];
+	double best, t;
+	size_t i, j, r;
+
+	if(!mkdtemp(root)) {
+		perror("mkdtemp");
+		return EXIT_FAILURE;
+	}
+	fprintf(stderr, "building %d entries in %s\n", NDIRS * PERDIR + NLINKS, root);
+	mktree();
+	snprintf(buf, sizeof buf, "%s/cache", root);
+	setenv("XDG_CACHE_HOME", buf, 1);
+
+	printf("%-12s %9s %8s  %s\n", "phase", "best ms", "items", "calls in the last run");
+	for(i = 0; i < LENGTH(phases); i++) {
+		for(best = 0, r = 0; r < REPS; r++) {
+			phases[i].setup();
+			memset(counts, 0, sizeof counts);
+			t = now();
+			phases[i].run();
+			t = now() - t;
+			if(r == 0 || t < best)
+				best = t;
+		}
+		printf("%-12s %9.3f %8lu ", phases[i].name, best * 1e3, (unsigned long)listed);
+		for(j = 0; j < CountLast; j++)
+			if(counts[j])
+				printf(" %s=%lu", countnames[j], counts[j]);
+		putchar('\n');
+	}
+
+	rmtree(root);
+	return EXIT_SUCCESS;
+}
+
+/* what dmenu_path does when its slot is fresh: copy the list out */
+void
+cached(void) {
+	char buf[4096];
+	ssize_t i, n;
+	int fd;
+
+	path_open();
+	if(path_stale(path_list_file())) {
+		fputs("cached: the list is stale\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	if((fd = open(path_list_file(), O_RDONLY)) < 0) {
+		perror("open");
+		exit(EXIT_FAILURE);
+	}
+	for(listed = 0; (n = read(fd, buf, sizeof buf)) > 0; )
+		for(i = 0; i < n; i++)
+			listed += buf[i] == '\n';
+	close(fd);
+	path_close();
+}
+
+void
+cold(void) {
+	char **progs;
+
+	path_open();
+	progs = path_update();
+	for(listed = 0; progs[listed]; listed++);
+	free(progs);
+	path_close();
+}
+
+void
+count(int c, unsigned long n) {
+	__sync_fetch_and_add(&counts[c], n); /* stat threads call in too */
+}
+
+/* the same as cold, but the index says only one directory changed */
+void
+incremental(void) {
+	cold();
+}
+
+/* what dmenu -run does when its slot is fresh: map the binary cache */
+void
+mapped(void) {
+	struct stat st;
+	void *map;
+	int fd;
+
+	path_open();
+	if(path_stale(path_bin_file())) {
+		fputs("mapped: the binary cache is stale\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	if((fd = open(path_bin_file(), O_RDONLY)) < 0 || fstat(fd, &st) < 0
+	|| (map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+		perror(path_bin_file());
+		exit(EXIT_FAILURE);
+	}
+	close(fd);
+	listed = ((const BinHeader *)map)->nitems;
+	munmap(map, st.st_size);
+	path_close();
+}
+
+/* PATH directories which share some names, with files of mixed modes and
+ * groups, directories among them, and a farm of symlinks into the rest */
+void
+mktree(void) {
+	char path[BUFSIZ], target[BUFSIZ], *env, *p;
+	gid_t groups[64];
+	int d, k, n, fd, ngroups;
+	static const mode_t modes[] = { 0755, 0755, 0755, 0644, 0750, 0705, 0710, 0 };
+
+	ngroups = getgroups(LENGTH(groups), groups);
+	if(!(env = malloc((NDIRS + 1) * (strlen(root) + 16))))
+		exit(EXIT_FAILURE);
+	p = env;
+	for(d = 0; d <= NDIRS; d++) {
+		snprintf(path, sizeof path, "%s/d%02d", root, d);
+		mkdir(path, 0755);
+		p += sprintf(p, "%s%s", d ? ":" : "", path);
+	}
+	for(d = 0; d < NDIRS; d++)
+		for(k = 0; k < PERDIR; k++) {
+			n = d * (PERDIR - OVERLAP) + k;
+			snprintf(path, sizeof path, "%s/d%02d/p%06d", root, d, n);
+			if(!modes[k % LENGTH(modes)]) {
+				mkdir(path, 0755);
+				continue;
+			}
+			if((fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600)) < 0) {
+				perror(path);
+				exit(EXIT_FAILURE);
+			}
+			fchmod(fd, modes[k % LENGTH(modes)]);
+			/* group execute only counts for another group of ours */
+			if(k % LENGTH(modes) == 6 && ngroups > 1)
+				if(fchown(fd, -1, groups[1]) < 0)
+					perror("fchown");
+			close(fd);
+		}
+	/* the last directory is the farm */
+	for(k = 0; k < NLINKS; k++) {
+		n = (k * 7) % (NDIRS * (PERDIR - OVERLAP));
+		if(k < NDANGLING)
+			snprintf(target, sizeof target, "%s/gone/p%06d", root, n);
+		else
+			snprintf(target, sizeof target, "%s/d%02d/p%06d", root, n / (PERDIR - OVERLAP), n);
+		snprintf(path, sizeof path, "%s/d%02d/l%06d", root, NDIRS, k);
+		if(symlink(target, path) < 0) {
+			perror(path);
+			exit(EXIT_FAILURE);
+		}
+	}
+	setenv("PATH", env, 1);
+	free(env);
+}
+
+double
+now(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void
+prepcold(void) {
+	char path[BUFSIZ];
+
+	snprintf(path, sizeof path, "%s/cache", root);
+	rmtree(path);
+}
+
+void
+prepincremental(void) {
+	char path[BUFSIZ];
+	int fd;
+
+	snprintf(path, sizeof path, "%s/d00/new%04u", root, added++);
+	if((fd = open(path, O_WRONLY | O_CREAT, 0755)) < 0) {
+		perror(path);
+		exit(EXIT_FAILURE);
+	}
+	close(fd);
+}
+
+void
+prepnothing(void) {
+}
+
+/* PATH is the synthetic one, so there is no rm -r to call */
+void
+rmtree(const char *path) {
+	char sub[BUFSIZ];
+	struct dirent *ent;
+	struct stat st;
+	DIR *dir;
+
+	if(lstat(path, &st) < 0)
+		return;
+	if(!S_ISDIR(st.st_mode)) {
+		unlink(path);
+		return;
+	}
+	if((dir = opendir(path))) {
+		while((ent = readdir(dir)))
+			if(strcmp(ent->d_name, ".") && strcmp(ent->d_name, "..")) {
+				snprintf(sub, sizeof sub, "%s/%s", path, ent->d_name);
+				rmtree(sub);
+			}
+		closedir(dir);
+	}
+	rmdir(path);
+}
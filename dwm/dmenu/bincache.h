@@ -0,0 +1,22 @@
+/* See LICENSE file for copyright and license details. */
+
+/* The item cache dmenu_path writes for dmenu -c, in host byte order: a
+ * header, one BinItem per item in sorted order, then the strings they point
+ * into, each NUL terminated.  Readers must check the magic and version and
+ * that the sizes add up to the size of the file. */
+#define BINMAGIC   "dmenubin"
+#define BINVERSION 2
+
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t nitems;
+	uint32_t longest;   /* index of the item with the most bytes */
+	uint32_t strsize;   /* bytes of strings after the items */
+} BinHeader;
+
+typedef struct {
+	uint32_t text;      /* offsets into the strings */
+	uint32_t fold;      /* text with A-Z in lower case, may equal text */
+	uint32_t len;       /* of text, in bytes */
+} BinItem;
@@ -13,18 +13,24 @@ XINERAMALIBS  = -lXinerama
 XINERAMAFLAGS = -DXINERAMA
 
 # Xft, comment if you don't want it
-XFTINC = $(shell pkg-config --cflags xft)
-XFTLIBS = $(shell pkg-config --libs xft)
+XFTINC = $(shell pkg-config --cflags xft fontconfig)
+XFTLIBS = $(shell pkg-config --libs xft fontconfig)
 
 # includes and libs
 INCS = -I${X11INC} ${XFTINC}
 LIBS = -L${X11LIB} -lX11 ${XINERAMALIBS} ${XFTLIBS}
 
 # flags
-CPPFLAGS = -D_BSD_SOURCE -D_POSIX_C_SOURCE=2 -DVERSION=\"${VERSION}\" ${XINERAMAFLAGS}
+CPPFLAGS = -D_BSD_SOURCE -D_POSIX_C_SOURCE=199309L -DVERSION=\"${VERSION}\" ${XINERAMAFLAGS}
 #CFLAGS   = -g -std=c99 -pedantic -Wall -O0 ${INCS} ${CPPFLAGS}
 CFLAGS   = -std=c99 -pedantic -Wall -Os ${INCS} ${CPPFLAGS}
 LDFLAGS  = -s ${LIBS}
 
+# calls counted by "make bench"
+BENCHWRAP = -Wl,--wrap=syscall,--wrap=open,--wrap=close,--wrap=fstatat,--wrap=stat \
+            -Wl,--wrap=access,--wrap=read,--wrap=mmap,--wrap=munmap,--wrap=mkdir \
+            -Wl,--wrap=mkstemp,--wrap=rename,--wrap=unlink,--wrap=utimensat \
+            -Wl,--wrap=fopen,--wrap=opendir
+
 # compiler and linker
 CC = cc
@@ -0,0 +1,619 @@
+/* See LICENSE file for copyright and license details.
+ *
+ * A pattern is parsed once into a Thompson NFA.  Items are then run through
+ * a DFA whose states, sets of NFA states, are only built the first time an
+ * input byte leads to them, and are kept until the state cache fills up.
+ * Two such caches share the NFA: one anchored at the start of the item, which
+ * tells exact and prefix matches apart, and one which may start a match at
+ * any offset.
+ *
+ * The syntax is a small subset of POSIX EREs: literals, ".", "[...]",
+ * "[^...]", "*", "+", "?", "|", "(...)", "^", "$", and "\" to quote the
+ * following character.  "." and negated classes consume a whole UTF-8
+ * sequence.
+ */
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <X11/Xlib.h>
+#include "draw.h"
+#include "dfa.h"
+
+#define MAXSTATES 256
+
+enum { NSet, NSplit, NEps, NBol, NEol, NMatch }; /* NFA opcodes */
+
+typedef struct {
+	int op;
+	int out, out1;
+	unsigned char set[32];      /* bytes accepted by NSet */
+} NState;
+
+typedef struct {
+	int start;
+	int out;                    /* dangling arrows, chained through them */
+} Frag;
+
+typedef struct {
+	int *set, n;                /* NFA states, in increasing order */
+	unsigned int hash;
+	Bool accept, acceptend;
+	int next[256];              /* -1 until the transition is computed */
+} DState;
+
+typedef struct {
+	DState *states;
+	int n, size;
+	int start;
+	unsigned int flushes;
+	Bool anchored;
+} Cache;
+
+struct Dfa {
+	NState *nfa;
+	int nnfa, size, start;
+	const char *p;              /* parse position */
+	Bool icase;
+	unsigned int *mark, gen;
+	int *work;
+	int *restart, nrestart;     /* NSet states a later search starts from */
+	Bool restartend;            /* the pattern matches empty at the end */
+	Cache anch, any;
+};
+
+static void addstate(Dfa *re, int s, Bool bol, Bool eol);
+static Frag alternate(Dfa *re, Frag a, Frag b);
+static int append(Dfa *re, int l1, int l2);
+static int *arrow(Dfa *re, int a);
+static Frag byteset(Dfa *re, const unsigned char *set);
+static Frag concat(Dfa *re, Frag a, Frag b);
+static Frag excluding(Dfa *re, int (*seqs)[4], int nseqs, int s, int j, int n);
+static void flush(Cache *c);
+static int lookup(Dfa *re, Cache *c);
+static Frag multibyte(Dfa *re, Frag f, Bool any, int (*seqs)[4], int nseqs);
+static int newstate(Dfa *re, int op, int out, int out1);
+static Bool parsealt(Dfa *re, Frag *f);
+static Bool parseatom(Dfa *re, Frag *f);
+static Bool parseclass(Dfa *re, Frag *f);
+static Bool parseconcat(Dfa *re, Frag *f);
+static Bool parserepeat(Dfa *re, Frag *f);
+static void patch(Dfa *re, int l, int s);
+static int run(Dfa *re, Cache *c, const unsigned char *s);
+static void setbyte(Dfa *re, unsigned char *set, int c);
+static int startstate(Dfa *re, Cache *c);
+static int step(Dfa *re, Cache *c, int from, int byte);
+static int utf8len(int c);
+
+void
+addstate(Dfa *re, int s, Bool bol, Bool eol) {
+	NState *n;
+
+	if(s < 0 || re->mark[s] == re->gen)
+		return;
+	re->mark[s] = re->gen;
+	n = &re->nfa[s];
+	switch(n->op) {
+	case NSplit:
+		addstate(re, n->out, bol, eol);
+		addstate(re, n->out1, bol, eol);
+		break;
+	case NEps:
+		addstate(re, n->out, bol, eol);
+		break;
+	case NBol:
+		if(bol)
+			addstate(re, n->out, bol, eol);
+		break;
+	case NEol:
+		if(eol)
+			addstate(re, n->out, bol, eol);
+		break;
+	}
+}
+
+Frag
+alternate(Dfa *re, Frag a, Frag b) {
+	Frag f;
+
+	f.start = newstate(re, NSplit, a.start, b.start);
+	f.out = append(re, a.out, b.out);
+	return f;
+}
+
+int
+append(Dfa *re, int l1, int l2) {
+	int l;
+
+	if(l1 < 0)
+		return l2;
+	for(l = l1; *arrow(re, l) >= 0; l = *arrow(re, l));
+	*arrow(re, l) = l2;
+	return l1;
+}
+
+int *
+arrow(Dfa *re, int a) {
+	return (a & 1) ? &re->nfa[a >> 1].out1 : &re->nfa[a >> 1].out;
+}
+
+Frag
+byteset(Dfa *re, const unsigned char *set) {
+	Frag f;
+
+	f.start = newstate(re, NSet, -1, -1);
+	memcpy(re->nfa[f.start].set, set, sizeof re->nfa[f.start].set);
+	f.out = 2 * f.start;
+	return f;
+}
+
+Frag
+concat(Dfa *re, Frag a, Frag b) {
+	patch(re, a.out, b.start);
+	a.out = b.out;
+	return a;
+}
+
+/* the n-byte UTF-8 sequences which start with the first j bytes of seqs[s],
+ * except those listed in seqs */
+Frag
+excluding(Dfa *re, int (*seqs)[4], int nseqs, int s, int j, int n) {
+	unsigned char set[32], used[32];
+	Frag f, g;
+	int c, i, k;
+
+	f.start = -1;
+	memset(used, 0, sizeof used);
+	for(i = 0; i < nseqs; i++) {
+		if(utf8len(seqs[i][0]) != n || (j && memcmp(seqs[i], seqs[s], j * sizeof seqs[i][0])))
+			continue;
+		c = seqs[i][j];
+		if(used[c >> 3] & (1 << (c & 7)))
+			continue;
+		used[c >> 3] |= 1 << (c & 7);
+		if(j + 1 == n || (g = excluding(re, seqs, nseqs, i, j + 1, n)).start < 0)
+			continue;
+		memset(set, 0, sizeof set);
+		setbyte(re, set, c);
+		g = concat(re, byteset(re, set), g);
+		f = f.start < 0 ? g : alternate(re, f, g);
+	}
+	/* any other byte here may be followed by any continuation bytes */
+	memset(set, 0, sizeof set);
+	for(k = j ? 0x80 : (0xff00 >> n) & 0xff; k < (j ? 0xc0 : (0xff00 >> (n + 1)) & 0xff); k++)
+		if(!(used[k >> 3] & (1 << (k & 7))))
+			setbyte(re, set, k);
+	for(k = 0; k < (int)sizeof set && !set[k]; k++);
+	if(k == sizeof set)
+		return f;
+	g = byteset(re, set);
+	memset(set, 0, sizeof set);
+	for(k = 0x80; k < 0xc0; k++)
+		setbyte(re, set, k);
+	for(i = j + 1; i < n; i++)
+		g = concat(re, g, byteset(re, set));
+	return f.start < 0 ? g : alternate(re, f, g);
+}
+
+Dfa *
+dfacompile(const char *pattern, Bool icase) {
+	Dfa *re;
+	Frag f;
+	int s;
+
+	if(!(re = calloc(1, sizeof *re)))
+		eprintf("cannot malloc %u bytes:", sizeof *re);
+	re->p = pattern;
+	re->icase = icase;
+	if(!parsealt(re, &f) || *re->p != '\0') {
+		dfafree(re);
+		return NULL;
+	}
+	s = newstate(re, NMatch, -1, -1);
+	patch(re, f.out, s);
+	re->start = f.start;
+	if(!(re->mark = calloc(re->nnfa, sizeof *re->mark))
+	|| !(re->work = malloc(re->nnfa * sizeof *re->work)))
+		eprintf("cannot malloc %u bytes:", re->nnfa * sizeof *re->mark);
+	if(!(re->restart = malloc(re->nnfa * sizeof *re->restart)))
+		eprintf("cannot malloc %u bytes:", re->nnfa * sizeof *re->restart);
+	re->gen++;
+	addstate(re, re->start, False, False);
+	for(s = 0; s < re->nnfa; s++)
+		if(re->mark[s] == re->gen && re->nfa[s].op == NSet)
+			re->restart[re->nrestart++] = s;
+	re->gen++;
+	addstate(re, re->start, False, True);
+	for(s = 0; s < re->nnfa; s++)
+		if(re->mark[s] == re->gen && re->nfa[s].op == NMatch)
+			re->restartend = True;
+	re->anch.anchored = True;
+	re->anch.start = re->any.start = -1;
+	return re;
+}
+
+void
+dfafree(Dfa *re) {
+	if(!re)
+		return;
+	flush(&re->anch);
+	flush(&re->any);
+	free(re->anch.states);
+	free(re->any.states);
+	free(re->nfa);
+	free(re->mark);
+	free(re->work);
+	free(re->restart);
+	free(re);
+}
+
+/* returns 0 if the whole of s matches, 1 if a match starts at its beginning,
+ * 2 if it starts anywhere else, and -1 if there is no match */
+int
+dfamatch(Dfa *re, const char *s) {
+	int r;
+
+	if((r = run(re, &re->anch, (const unsigned char *)s)) >= 0)
+		return r;
+	return run(re, &re->any, (const unsigned char *)s) >= 0 ? 2 : -1;
+}
+
+void
+flush(Cache *c) {
+	int i;
+
+	for(i = 0; i < c->n; i++)
+		free(c->states[i].set);
+	c->n = 0;
+	c->start = -1;
+	c->flushes++;
+}
+
+/* find or add the DFA state holding the NFA states marked by addstate() */
+int
+lookup(Dfa *re, Cache *c) {
+	DState *d;
+	unsigned int h = 0;
+	int i, n = 0;
+
+	for(i = 0; i < re->nnfa; i++)
+		if(re->mark[i] == re->gen && (re->nfa[i].op == NSet || re->nfa[i].op == NEol
+		                              || re->nfa[i].op == NMatch)) {
+			re->work[n++] = i;
+			h = h * 31 + i;
+		}
+	for(i = 0; i < c->n; i++)
+		if(c->states[i].hash == h && c->states[i].n == n
+		&& !memcmp(c->states[i].set, re->work, n * sizeof *re->work))
+			return i;
+	if(c->n == MAXSTATES)
+		flush(c);
+	if(c->n == c->size) {
+		c->size = c->size ? c->size * 2 : 16;
+		if(!(c->states = realloc(c->states, c->size * sizeof *c->states)))
+			eprintf("cannot realloc %u bytes:", c->size * sizeof *c->states);
+	}
+	d = &c->states[c->n];
+	if(!(d->set = malloc(n * sizeof *d->set + 1)))
+		eprintf("cannot malloc %u bytes:", n * sizeof *d->set);
+	memcpy(d->set, re->work, n * sizeof *d->set);
+	d->n = n;
+	d->hash = h;
+	for(i = 0; i < 256; i++)
+		d->next[i] = -1;
+	/* accepting now, or once the end of the item satisfies any pending $ */
+	d->accept = False;
+	re->gen++;
+	for(i = 0; i < n; i++) {
+		if(re->nfa[d->set[i]].op == NMatch)
+			d->accept = True;
+		addstate(re, d->set[i], False, True);
+	}
+	for(i = 0, d->acceptend = False; i < re->nnfa && !d->acceptend; i++)
+		d->acceptend = re->mark[i] == re->gen && re->nfa[i].op == NMatch;
+	return c->n++;
+}
+
+/* alternatives for multi-byte UTF-8 sequences: either any of them, or those
+ * listed in seqs, each given as up to 4 bytes */
+Frag
+multibyte(Dfa *re, Frag f, Bool any, int (*seqs)[4], int nseqs) {
+	unsigned char set[32];
+	Frag g, h;
+	int i, j, k, n;
+
+	for(i = 0; i < (any ? 3 : nseqs); i++) {
+		n = any ? i + 2 : utf8len(seqs[i][0]);
+		for(j = 0; j < n; j++) {
+			memset(set, 0, sizeof set);
+			if(!any)
+				setbyte(re, set, seqs[i][j]);
+			else if(j > 0)
+				for(k = 0x80; k < 0xc0; k++)
+					setbyte(re, set, k);
+			else
+				for(k = (0xff00 >> n) & 0xff; k < ((0xff00 >> (n + 1)) & 0xff); k++)
+					setbyte(re, set, k);
+			h = byteset(re, set);
+			g = j ? concat(re, g, h) : h;
+		}
+		f = f.start < 0 ? g : alternate(re, f, g);
+	}
+	return f;
+}
+
+int
+newstate(Dfa *re, int op, int out, int out1) {
+	NState *s;
+
+	if(re->nnfa == re->size) {
+		re->size = re->size ? re->size * 2 : 32;
+		if(!(re->nfa = realloc(re->nfa, re->size * sizeof *re->nfa)))
+			eprintf("cannot realloc %u bytes:", re->size * sizeof *re->nfa);
+	}
+	s = &re->nfa[re->nnfa];
+	memset(s, 0, sizeof *s);
+	s->op = op;
+	s->out = out;
+	s->out1 = out1;
+	return re->nnfa++;
+}
+
+Bool
+parsealt(Dfa *re, Frag *f) {
+	Frag g;
+
+	if(!parseconcat(re, f))
+		return False;
+	while(*re->p == '|') {
+		re->p++;
+		if(!parseconcat(re, &g))
+			return False;
+		*f = alternate(re, *f, g);
+	}
+	return True;
+}
+
+Bool
+parseatom(Dfa *re, Frag *f) {
+	unsigned char set[32];
+	int seq[1][4];
+	int c, i, n;
+
+	memset(set, 0, sizeof set);
+	switch((c = (unsigned char)*re->p++)) {
+	case '(':
+		if(!parsealt(re, f) || *re->p++ != ')')
+			return False;
+		return True;
+	case '[':
+		return parseclass(re, f);
+	case '.':
+		for(i = 0; i < 0x80; i++)
+			setbyte(re, set, i);
+		for(i = 0x80; i < 0xc0; i++) /* stray continuation bytes */
+			setbyte(re, set, i);
+		for(i = 0xf8; i < 0x100; i++)
+			setbyte(re, set, i);
+		*f = multibyte(re, byteset(re, set), True, NULL, 0);
+		return True;
+	case '^':
+		f->start = newstate(re, NBol, -1, -1);
+		f->out = 2 * f->start;
+		return True;
+	case '$':
+		f->start = newstate(re, NEol, -1, -1);
+		f->out = 2 * f->start;
+		return True;
+	case '*': case '+': case '?': /* nothing to repeat */
+		return False;
+	case '\\':
+		if(!(c = (unsigned char)*re->p++))
+			return False;
+		/* fallthrough */
+	default:
+		if((n = utf8len(c)) == 1) {
+			setbyte(re, set, c);
+			*f = byteset(re, set);
+			return True;
+		}
+		for(seq[0][0] = c, i = 1; i < n; i++)
+			if(((seq[0][i] = (unsigned char)*re->p++) & 0xc0) != 0x80)
+				return False;
+		f->start = -1;
+		*f = multibyte(re, *f, False, seq, 1);
+		return True;
+	}
+}
+
+Bool
+parseclass(Dfa *re, Frag *f) {
+	unsigned char set[32];
+	int (*seqs)[4] = NULL;
+	int c, d, i, n, nseqs = 0;
+	Bool negate = False;
+	Frag g;
+
+	memset(set, 0, sizeof set);
+	if(*re->p == '^') {
+		negate = True;
+		re->p++;
+	}
+	for(i = 0; *re->p != ']' || i == 0; i++) {
+		if(!(c = (unsigned char)*re->p++) || (c == '\\' && !(c = (unsigned char)*re->p++)))
+			goto error;
+		if((n = utf8len(c)) > 1) {
+			if(!(seqs = realloc(seqs, ++nseqs * sizeof *seqs)))
+				eprintf("cannot realloc %u bytes:", nseqs * sizeof *seqs);
+			for(seqs[nseqs-1][0] = c, d = 1; d < n; d++)
+				if(((seqs[nseqs-1][d] = (unsigned char)*re->p++) & 0xc0) != 0x80)
+					goto error;
+			continue;
+		}
+		d = c;
+		if(re->p[0] == '-' && re->p[1] != ']' && re->p[1] != '\0'
+		&& utf8len((unsigned char)re->p[1]) == 1) {
+			d = (unsigned char)re->p[1];
+			re->p += 2;
+		}
+		for(; c <= d; c++)
+			setbyte(re, set, c);
+	}
+	re->p++;
+	if(negate) {
+		for(i = 0; i < 0x80 / 8; i++)
+			set[i] = ~set[i];
+		memset(set + 0x80 / 8, 0, sizeof set - 0x80 / 8);
+		*f = byteset(re, set);
+		for(n = 2; n <= 4; n++) {
+			g = excluding(re, seqs, nseqs, 0, 0, n);
+			if(g.start >= 0)
+				*f = alternate(re, *f, g);
+		}
+	}
+	else {
+		f->start = -1;
+		for(i = 0; i < (int)sizeof set; i++)
+			if(set[i]) {
+				*f = byteset(re, set);
+				break;
+			}
+		*f = multibyte(re, *f, False, seqs, nseqs);
+		if(f->start < 0) /* cannot happen, a class is never empty */
+			goto error;
+	}
+	free(seqs);
+	return True;
+error:
+	free(seqs);
+	return False;
+}
+
+Bool
+parseconcat(Dfa *re, Frag *f) {
+	Frag g;
+
+	f->start = newstate(re, NEps, -1, -1);
+	f->out = 2 * f->start;
+	while(*re->p != '\0' && *re->p != '|' && *re->p != ')') {
+		if(!parserepeat(re, &g))
+			return False;
+		*f = concat(re, *f, g);
+	}
+	return True;
+}
+
+Bool
+parserepeat(Dfa *re, Frag *f) {
+	int s;
+
+	if(!parseatom(re, f))
+		return False;
+	for(;; re->p++)
+		switch(*re->p) {
+		case '*':
+			s = newstate(re, NSplit, f->start, -1);
+			patch(re, f->out, s);
+			f->start = s;
+			f->out = 2 * s + 1;
+			break;
+		case '+':
+			s = newstate(re, NSplit, f->start, -1);
+			patch(re, f->out, s);
+			f->out = 2 * s + 1;
+			break;
+		case '?':
+			s = newstate(re, NSplit, f->start, -1);
+			f->start = s;
+			f->out = append(re, f->out, 2 * s + 1);
+			break;
+		default:
+			return True;
+		}
+}
+
+void
+patch(Dfa *re, int l, int s) {
+	int next;
+
+	for(; l >= 0; l = next) {
+		next = *arrow(re, l);
+		*arrow(re, l) = s;
+	}
+}
+
+int
+run(Dfa *re, Cache *c, const unsigned char *s) {
+	int st, nx;
+	Bool hit;
+
+	st = startstate(re, c);
+	hit = c->states[st].accept;
+	for(; *s && !(hit && !c->anchored); s++) {
+		if((nx = c->states[st].next[*s]) < 0)
+			nx = step(re, c, st, *s);
+		st = nx;
+		if(c->states[st].n == 0 && (c->anchored || (!re->nrestart && !re->restartend)))
+			break;
+		if(c->states[st].accept)
+			hit = True;
+	}
+	if(*s == '\0' && (c->states[st].acceptend || (!c->anchored && re->restartend)))
+		return 0;
+	return hit ? 1 : -1;
+}
+
+void
+setbyte(Dfa *re, unsigned char *set, int c) {
+	set[c >> 3] |= 1 << (c & 7);
+	if(re->icase && c < 0x80 && isalpha(c)) {
+		c = islower(c) ? toupper(c) : tolower(c);
+		set[c >> 3] |= 1 << (c & 7);
+	}
+}
+
+int
+startstate(Dfa *re, Cache *c) {
+	if(c->start < 0) {
+		re->gen++;
+		addstate(re, re->start, True, False);
+		c->start = lookup(re, c);
+	}
+	return c->start;
+}
+
+int
+step(Dfa *re, Cache *c, int from, int byte) {
+	DState *d = &c->states[from];
+	unsigned int flushes = c->flushes;
+	NState *n;
+	int i, to;
+
+	re->gen++;
+	for(i = 0; i < d->n; i++) {
+		n = &re->nfa[d->set[i]];
+		if(n->op == NSet && n->set[byte >> 3] & (1 << (byte & 7)))
+			addstate(re, n->out, False, False);
+	}
+	/* a new match may only begin where a character does */
+	if(!c->anchored && (byte & 0xc0) != 0x80)
+		for(i = 0; i < re->nrestart; i++) {
+			n = &re->nfa[re->restart[i]];
+			if(n->set[byte >> 3] & (1 << (byte & 7)))
+				addstate(re, n->out, False, False);
+		}
+	to = lookup(re, c);
+	if(c->flushes == flushes) /* otherwise from is gone */
+		c->states[from].next[byte] = to;
+	return to;
+}
+
+int
+utf8len(int c) {
+	if(c >= 0xf0 && c < 0xf8)
+		return 4;
+	if(c >= 0xe0 && c < 0xf0)
+		return 3;
+	if(c >= 0xc0 && c < 0xe0)
+		return 2;
+	return 1;
+}
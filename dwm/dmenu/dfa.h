@@ -0,0 +1,7 @@
+/* See LICENSE file for copyright and license details. */
+
+typedef struct Dfa Dfa;
+
+Dfa *dfacompile(const char *pattern, Bool icase);
+void dfafree(Dfa *re);
+int dfamatch(Dfa *re, const char *s);
@@ -1,10 +1,17 @@
 /* See LICENSE file for copyright and license details. */
 #include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
+#include <time.h>
 #include <unistd.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <X11/Xlib.h>
 #include <X11/Xatom.h>
 #include <X11/Xutil.h>
@@ -12,33 +19,69 @@
 #include <X11/extensions/Xinerama.h>
 #endif
 #include "draw.h"
+#include "dfa.h"
+#include "bincache.h"
+#include "path.h"
+#include "pinyin.h"
 
 #define INTERSECT(x,y,w,h,r)  (MAX(0, MIN((x)+(w),(r).x_org+(r).width)  - MAX((x),(r).x_org)) \
                              * MAX(0, MIN((y)+(h),(r).y_org+(r).height) - MAX((y),(r).y_org)))
 #define MIN(a,b)              ((a) < (b) ? (a) : (b))
 #define MAX(a,b)              ((a) > (b) ? (a) : (b))
+#define LENGTH(X)             (sizeof X / sizeof X[0])
 #define DEFFONT "fixed" /* xft example: "Monospace-11" */
 
+enum { Clipboard, UTF8String, DWMSelMon, AtomLast }; /* atoms */
+
+typedef struct {
+	size_t len;
+	unsigned int dist;              /* edits allowed */
+	unsigned long long peq[256];    /* positions of each byte in the token */
+} Pattern;
+
+typedef struct {
+	const char *name;
+	long at, us;                    /* microseconds since startup */
+	unsigned long requests, roundtrips;
+} Phase;
+
 typedef struct Item Item;
 struct Item {
 	char *text;
+	char *fold;  /* text in lower case, if it came from a binary cache */
+	char *py;    /* pinyin initials and full pinyin, NUL separated */
 	Item *left, *right;
 };
 
+static void additem(char *buf, size_t i, size_t *size);
 static void appenditem(Item *item, Item **list, Item **last);
+static unsigned int approxstr(const char *s, const Pattern *pat);
 static void calcoffsets(void);
 static void cleanup(void);
+static int countreply(Display *dpy);
 static char *cistrstr(const char *s, const char *sub);
 static void drawmenu(void);
+static void execute(const char *cmd);
 static void grabkeyboard(void);
+static void imdestroy(XIM im, XPointer client, XPointer call);
+static void iminstantiate(Display *dpy, XPointer client, XPointer call);
 static void insert(const char *str, ssize_t n);
 static void keypress(XKeyEvent *ev);
 static void match(void);
 static size_t nextrune(int inc);
+static void openim(void);
 static void paste(void);
+static void phase(const char *name);
+static char *pyshadow(const char *s);
+static int rank(const char *s, const char *tok, size_t len);
+static int rerank(Dfa *re, Item *item);
+static void readcache(const char *file);
 static void readstdin(void);
+static void report(void);
 static void run(void);
 static void setup(void);
+static unsigned int tokdist(const char *s, const char *tok, const Pattern *pat);
+static long uptime(void);
 static void usage(void);
 
 static char text[BUFSIZ] = "";
@@ -52,18 +95,34 @@ static const char *normfgcolor = "#bbbbbb";
 static const char *selbgcolor  = "#005577";
 static const char *selfgcolor  = "#eeeeee";
 static unsigned int lines = 0;
+static unsigned int maxdist = 0;
 static ColorSet *normcol;
 static ColorSet *selcol;
+static char *atomnames[AtomLast] = { "CLIPBOARD", "UTF8_STRING", "_DWM_SELMON" };
 static Atom clip, utf8;
 static Bool topbar = True;
+static Bool caseins = False;
+static Bool pinyin = False;
+static Bool folded = False; /* -i matches against Item.fold, case sensitively */
+static Bool launch = False;
+static const char *command = NULL; /* to run once dmenu is gone */
+static Bool regex = False;
 static Bool running = True;
+static Bool grabbed = False;
+static long grabnext = 0;  /* when to try grabbing again, 0 if not tried yet */
+static Bool timing = False;
+static Phase phases[8];
+static size_t nphases = 0;
+static struct timespec epoch;
+static unsigned long lastread, roundtrips = 0;
 static int ret = 0;
 static DC *dc;
 static Item *items = NULL;
 static Item *matches, *matchend;
 static Item *prev, *curr, *next, *sel;
 static Window win;
-static XIC xic;
+static XIM xim = NULL;
+static XIC xic = NULL;
 
 static int (*fstrncmp)(const char *, const char *, size_t) = strncmp;
 static char *(*fstrstr)(const char *, const char *) = strstr;
@@ -71,8 +130,11 @@ static char *(*fstrstr)(const char *, const char *) = strstr;
 int
 main(int argc, char *argv[]) {
 	Bool fast = False;
+	const char *cachefile = NULL, *env;
 	int i;
 
+	clock_gettime(CLOCK_MONOTONIC, &epoch);
+	timing = (env = getenv("DMENU_TIMING")) && *env;
 	for(i = 1; i < argc; i++)
 		/* these options take no arguments */
 		if(!strcmp(argv[i], "-v")) {      /* prints version information */
@@ -86,12 +148,25 @@ main(int argc, char *argv[]) {
 		else if(!strcmp(argv[i], "-i")) { /* case-insensitive item matching */
 			fstrncmp = strncasecmp;
 			fstrstr = cistrstr;
+			caseins = True;
 		}
+		else if(!strcmp(argv[i], "-py")) /* match hanzi by their pinyin */
+			pinyin = True;
+		else if(!strcmp(argv[i], "-r"))   /* input is a regular expression */
+			regex = True;
+		else if(!strcmp(argv[i], "-run")) /* lists and runs programs in $PATH */
+			launch = True;
+		else if(!strcmp(argv[i], "-T"))   /* reports startup timing on stderr */
+			timing = True;
 		else if(i+1 == argc)
 			usage();
 		/* these options take one argument */
 		else if(!strcmp(argv[i], "-l"))   /* number of lines in vertical list */
 			lines = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-a"))   /* edits allowed per token */
+			maxdist = MAX(atoi(argv[++i]), 0);
+		else if(!strcmp(argv[i], "-c"))   /* maps items from a binary cache */
+			cachefile = argv[++i];
 		else if(!strcmp(argv[i], "-p"))   /* adds prompt to left of input field */
 			prompt = argv[++i];
 		else if(!strcmp(argv[i], "-fn"))  /* font or font set */
@@ -108,25 +183,77 @@ main(int argc, char *argv[]) {
 			usage();
 
 	dc = initdc();
+	if(timing) {
+		XSetAfterFunction(dc->dpy, countreply);
+		roundtrips = 1; /* connection setup */
+	}
+	phase("initdc");
 	initfont(dc, font ? font : DEFFONT);
+	phase("initfont");
 	normcol = initcolor(dc, normfgcolor, normbgcolor);
 	selcol = initcolor(dc, selfgcolor, selbgcolor);
+	phase("initcolor");
 
-	if(fast) {
+	if(launch) {
+		path_open();
+		if(path_stale(path_bin_file()))
+			free(path_update());
+		readcache(path_bin_file());
+		path_close();
+		phase("readpath");
+		grabkeyboard();
+		phase("grabkeyboard");
+	}
+	else if(cachefile) {
+		readcache(cachefile);
+		phase("readcache");
 		grabkeyboard();
+		phase("grabkeyboard");
+	}
+	else if(fast) {
+		grabkeyboard();
+		phase("grabkeyboard");
 		readstdin();
+		phase("readstdin");
 	}
 	else {
 		readstdin();
+		phase("readstdin");
 		grabkeyboard();
+		phase("grabkeyboard");
 	}
 	setup();
+	XFlush(dc->dpy); /* so the map phase includes sending the first frame */
+	phase("map");
+	report();
 	run();
 
 	cleanup();
+	if(command)
+		execute(command);
 	return ret;
 }
 
+void
+additem(char *buf, size_t i, size_t *size) {
+	char *p;
+	size_t n;
+
+	if(i+1 >= *size / sizeof *items)
+		if(!(items = realloc(items, (*size += BUFSIZ))))
+			eprintf("cannot realloc %u bytes:", *size);
+	if(!(items[i].text = strdup(buf)))
+		eprintf("cannot strdup %u bytes:", strlen(buf)+1);
+	items[i].fold = items[i].py = NULL;
+	if(pinyin && (p = pyshadow(buf))) {
+		n = strlen(p) + 1;
+		n += strlen(p + n) + 1;
+		if(!(items[i].py = malloc(n)))
+			eprintf("cannot malloc %u bytes:", n);
+		memcpy(items[i].py, p, n);
+	}
+}
+
 void
 appenditem(Item *item, Item **list, Item **last) {
 	if(*last)
@@ -139,6 +266,34 @@ appenditem(Item *item, Item **list, Item **last) {
 	*last = item;
 }
 
+unsigned int
+approxstr(const char *s, const Pattern *pat) {
+	unsigned long long pv = ~0ULL, mv = 0, ph, mh, xv, xh, eq;
+	unsigned long long last = 1ULL << (pat->len - 1);
+	unsigned int score = pat->len, best = pat->len;
+
+	/* Myers' bit-vector search: smallest edit distance of the token
+	 * against any substring of s, one column per byte of s */
+	for(; *s && best > 0; s++) {
+		eq = pat->peq[(unsigned char)*s];
+		xv = eq | mv;
+		xh = (((eq & pv) + pv) ^ pv) | eq;
+		ph = mv | ~(xh | pv);
+		mh = pv & xh;
+		if(ph & last)
+			score++;
+		else if(mh & last)
+			score--;
+		ph <<= 1;
+		mh <<= 1;
+		pv = mh | ~(xv | ph);
+		mv = ph & xv;
+		if(score < best)
+			best = score;
+	}
+	return best;
+}
+
 void
 calcoffsets(void) {
 	int i, n;
@@ -175,6 +330,18 @@ cleanup(void) {
     freedc(dc);
 }
 
+/* called after each request: Xlib has waited for a reply if that left none
+ * outstanding, and the last one it knows processed has moved */
+int
+countreply(Display *dpy) {
+	unsigned long last = LastKnownRequestProcessed(dpy);
+
+	if(last != lastread && last == NextRequest(dpy) - 1)
+		roundtrips++;
+	lastread = last;
+	return 0;
+}
+
 void
 drawmenu(void) {
 	int curpos;
@@ -223,18 +390,56 @@ drawmenu(void) {
 	mapdc(dc, win, mw, mh);
 }
 
+/* -run: split cmd at blanks, as dmenu_run's "exec $exe" did, and become it */
+void
+execute(const char *cmd) {
+	char buf[sizeof text], *argv[sizeof text / 2 + 1];
+	int argc = 0;
+
+	strncpy(buf, cmd, sizeof buf - 1);
+	buf[sizeof buf - 1] = '\0';
+	for(argv[argc] = strtok(buf, " \t"); argv[argc]; argv[++argc] = strtok(NULL, " \t"));
+	if(argc == 0)
+		return;
+	execvp(argv[0], argv);
+	eprintf("cannot run '%s':", argv[0]);
+}
+
+/* another process may hold the keyboard for a while, so rather than wait for
+ * it this tries once, and again later with the wait doubled each time */
 void
 grabkeyboard(void) {
-	int i;
+	static long first, wait = 1000;
+	long now;
 
-	/* try to grab keyboard, we may have to wait for another process to ungrab */
-	for(i = 0; i < 1000; i++) {
-		if(XGrabKeyboard(dc->dpy, DefaultRootWindow(dc->dpy), True,
-		                 GrabModeAsync, GrabModeAsync, CurrentTime) == GrabSuccess)
-			return;
-		usleep(1000);
+	if(grabbed || (now = uptime()) < grabnext)
+		return;
+	if(XGrabKeyboard(dc->dpy, DefaultRootWindow(dc->dpy), True,
+	                 GrabModeAsync, GrabModeAsync, CurrentTime) == GrabSuccess) {
+		grabbed = True;
+		return;
 	}
-	eprintf("cannot grab keyboard\n");
+	if(!grabnext)
+		first = now;
+	else if(now - first > 1000000)
+		eprintf("cannot grab keyboard\n");
+	else
+		wait = MIN(wait * 2, 64000);
+	grabnext = now + wait;
+}
+
+/* the input method went away; take it back whenever it returns */
+void
+imdestroy(XIM im, XPointer client, XPointer call) {
+	xim = NULL;
+	xic = NULL;
+	XRegisterIMInstantiateCallback(dc->dpy, NULL, NULL, NULL, iminstantiate, NULL);
+}
+
+void
+iminstantiate(Display *dpy, XPointer client, XPointer call) {
+	XUnregisterIMInstantiateCallback(dpy, NULL, NULL, NULL, iminstantiate, NULL);
+	openim();
 }
 
 void
@@ -256,9 +461,18 @@ keypress(XKeyEvent *ev) {
 	KeySym ksym = NoSymbol;
 	Status status;
 
-	len = XmbLookupString(xic, ev, buf, sizeof buf, &ksym, &status);
-	if(status == XBufferOverflow)
-		return;
+	if(xic) {
+		len = XmbLookupString(xic, ev, buf, sizeof buf, &ksym, &status);
+		if(status == XBufferOverflow)
+			return;
+	}
+	else if((len = XLookupString(ev, buf, sizeof buf, &ksym, NULL)) == 1
+	     && (unsigned char)buf[0] >= 0x80) {
+		/* no input method yet: Latin-1 to UTF-8 */
+		buf[1] = 0x80 | (buf[0] & 0x3f);
+		buf[0] = 0xc0 | ((unsigned char)buf[0] >> 6);
+		len = 2;
+	}
 	if(ev->state & ControlMask)
 		switch(ksym) {
 		case XK_a: ksym = XK_Home;      break;
@@ -375,7 +589,10 @@ keypress(XKeyEvent *ev) {
 		break;
 	case XK_Return:
 	case XK_KP_Enter:
-		puts((sel && !(ev->state & ShiftMask)) ? sel->text : text);
+		if(launch)
+			command = (sel && !(ev->state & ShiftMask)) ? sel->text : text;
+		else
+			puts((sel && !(ev->state & ShiftMask)) ? sel->text : text);
 		ret = EXIT_SUCCESS;
 		running = False;
 	case XK_Right:
@@ -407,51 +624,105 @@ void
 match(void) {
 	static char **tokv = NULL;
 	static int tokn = 0;
+	static Pattern *patv = NULL;
+	static int patn = 0;
+	static Item **lists = NULL;
+	static size_t listn = 0;
+	static Dfa *re = NULL;
 
 	char buf[sizeof text], *s;
 	int i, tokc = 0;
-	size_t len;
-	Item *item, *lprefix, *lsubstr, *prefixend, *substrend;
+	size_t j, k, len, nlists;
+	unsigned int d, e, dmax = 0;
+	Item *item;
+	Pattern *pat = NULL;
 
 	strcpy(buf, text);
+	if(folded)
+		for(s = buf; *s; s++)
+			*s = tolower((unsigned char)*s);
 	/* separate input text into tokens to be matched individually */
 	for(s = strtok(buf, " "); s; tokv[tokc-1] = s, s = strtok(NULL, " "))
 		if(++tokc > tokn && !(tokv = realloc(tokv, ++tokn * sizeof *tokv)))
 			eprintf("cannot realloc %u bytes\n", tokn * sizeof *tokv);
 	len = tokc ? strlen(tokv[0]) : 0;
 
-	matches = lprefix = lsubstr = matchend = prefixend = substrend = NULL;
+	if(regex) {
+		/* the whole input is one pattern, compiled once per edit */
+		dfafree(re);
+		re = *text ? dfacompile(text, caseins) : NULL;
+	}
+	else if(maxdist > 0) {
+		/* build the bit-parallel match tables once per query */
+		if(tokc > patn && !(patv = realloc(patv, (patn = tokc) * sizeof *patv)))
+			eprintf("cannot realloc %u bytes\n", patn * sizeof *patv);
+		for(i = 0; i < tokc; i++) {
+			pat = &patv[i];
+			pat->len = strlen(tokv[i]);
+			/* short tokens would match almost anything with an edit to spare */
+			pat->dist = pat->len <= 64 ? MIN(maxdist, (pat->len - 1) / 2) : 0;
+			memset(pat->peq, 0, sizeof pat->peq);
+			for(j = 0; j < pat->len && j < 64; j++) {
+				k = (unsigned char)tokv[i][j];
+				pat->peq[k] |= 1ULL << j;
+				if(caseins) {
+					pat->peq[tolower(k)] |= 1ULL << j;
+					pat->peq[toupper(k)] |= 1ULL << j;
+				}
+			}
+			dmax += pat->dist;
+		}
+	}
+	/* one head/tail pair per rank: edit distance, then exact, prefix, substring */
+	nlists = 3 * (dmax + 1);
+	if(nlists > listn && !(lists = realloc(lists, (listn = nlists) * 2 * sizeof *lists)))
+		eprintf("cannot realloc %u bytes\n", listn * 2 * sizeof *lists);
+	memset(lists, 0, nlists * 2 * sizeof *lists);
+
 	for(item = items; item && item->text; item++) {
-		for(i = 0; i < tokc; i++)
-			if(!fstrstr(item->text, tokv[i]))
+		s = folded ? item->fold : item->text;
+		if(regex && *text) {
+			if(!re) /* not a valid pattern, or not yet */
+				break;
+			if((i = rerank(re, item)) < 0)
+				continue;
+			j = 2 * i; /* no edit distance in regex mode */
+			appenditem(item, &lists[j], &lists[j+1]);
+			continue;
+		}
+		for(i = 0, d = 0; i < tokc; i++) {
+			if(maxdist > 0)
+				pat = &patv[i];
+			if((e = tokdist(s, tokv[i], pat)) && item->py) {
+				e = MIN(e, tokdist(item->py, tokv[i], pat));
+				e = MIN(e, tokdist(item->py + strlen(item->py) + 1, tokv[i], pat));
+			}
+			if(e > (pat ? pat->dist : 0))
 				break;
+			d += e;
+		}
 		if(i != tokc) /* not all tokens match */
 			continue;
 		/* exact matches go first, then prefixes, then substrings */
-		if(!tokc || !fstrncmp(tokv[0], item->text, len+1))
-			appenditem(item, &matches, &matchend);
-		else if(!fstrncmp(tokv[0], item->text, len))
-			appenditem(item, &lprefix, &prefixend);
-		else
-			appenditem(item, &lsubstr, &substrend);
-	}
-	if(lprefix) {
-		if(matches) {
-			matchend->right = lprefix;
-			lprefix->left = matchend;
+		j = tokc ? rank(s, tokv[0], len) : 0;
+		if(j && item->py) {
+			j = MIN(j, rank(item->py, tokv[0], len));
+			j = MIN(j, rank(item->py + strlen(item->py) + 1, tokv[0], len));
 		}
-		else
-			matches = lprefix;
-		matchend = prefixend;
+		j = 2 * (3 * d + j);
+		appenditem(item, &lists[j], &lists[j+1]);
 	}
-	if(lsubstr) {
+	matches = matchend = NULL;
+	for(j = 0; j < nlists; j++) {
+		if(!lists[2*j])
+			continue;
 		if(matches) {
-			matchend->right = lsubstr;
-			lsubstr->left = matchend;
+			matchend->right = lists[2*j];
+			lists[2*j]->left = matchend;
 		}
 		else
-			matches = lsubstr;
-		matchend = substrend;
+			matches = lists[2*j];
+		matchend = lists[2*j+1];
 	}
 	curr = sel = matches;
 	calcoffsets();
@@ -466,6 +737,23 @@ nextrune(int inc) {
 	return n;
 }
 
+/* keys are looked up without an input context until this succeeds */
+void
+openim(void) {
+	XIMCallback destroy = { NULL, imdestroy };
+
+	if(!(xim = XOpenIM(dc->dpy, NULL, NULL, NULL))) {
+		XRegisterIMInstantiateCallback(dc->dpy, NULL, NULL, NULL, iminstantiate, NULL);
+		return;
+	}
+	XSetIMValues(xim, XNDestroyCallback, &destroy, NULL);
+	if(!(xic = XCreateIC(xim, XNInputStyle, XIMPreeditNothing | XIMStatusNothing,
+	                     XNClientWindow, win, XNFocusWindow, win, NULL))) {
+		XCloseIM(xim);
+		xim = NULL;
+	}
+}
+
 void
 paste(void) {
 	char *p, *q;
@@ -481,22 +769,185 @@ paste(void) {
 	drawmenu();
 }
 
+char *
+pyshadow(const char *s) {
+	static char buf[4 * sizeof text];
+	char *full, *ini = buf, *p;
+	const char *q, *syl;
+	unsigned int c, n = 0;
+	int lo, hi, mid;
+	size_t len = strlen(s);
+
+	/* initials go to the front of buf, full pinyin after them */
+	full = p = buf + len + 1;
+	while(*s) {
+		q = s;
+		c = (unsigned char)*s++;
+		if((c & 0xf0) == 0xe0 && (s[0] & 0xc0) == 0x80 && (s[1] & 0xc0) == 0x80) {
+			c = (c & 0x0f) << 12 | (s[0] & 0x3f) << 6 | (s[1] & 0x3f);
+			s += 2;
+			for(lo = 0, hi = LENGTH(pytab) - 1; lo <= hi; ) {
+				mid = (lo + hi) / 2;
+				if(pytab[mid].cp < c)
+					lo = mid + 1;
+				else if(pytab[mid].cp > c)
+					hi = mid - 1;
+				else {
+					syl = pysyls[pytab[mid].syl];
+					*ini++ = *syl;
+					while(*syl)
+						*p++ = *syl++;
+					n++;
+					break;
+				}
+			}
+			if(lo <= hi)
+				continue;
+		}
+		for(; q < s; q++)
+			*ini++ = *p++ = *q;
+	}
+	if(!n) /* nothing to add over the plain text */
+		return NULL;
+	*ini++ = '\0';
+	*p++ = '\0';
+	memmove(ini, full, p - full);
+	return buf;
+}
+
+int
+rank(const char *s, const char *tok, size_t len) {
+	if(!fstrncmp(tok, s, len+1))
+		return 0;
+	if(!fstrncmp(tok, s, len))
+		return 1;
+	return 2;
+}
+
+int
+rerank(Dfa *re, Item *item) {
+	int r, best;
+
+	/* rank by where the first match starts, as for tokens */
+	if((best = dfamatch(re, item->text)) != 0 && item->py) {
+		if((r = dfamatch(re, item->py)) >= 0 && (best < 0 || r < best))
+			best = r;
+		if((r = dfamatch(re, item->py + strlen(item->py) + 1)) >= 0 && (best < 0 || r < best))
+			best = r;
+	}
+	return best;
+}
+
+void
+phase(const char *name) {
+	static long then = 0;
+	static unsigned long requests = 0, trips = 0;
+	Phase *p;
+	long now;
+
+	if(!timing || nphases == LENGTH(phases))
+		return;
+	now = uptime();
+	p = &phases[nphases++];
+	p->name = name;
+	p->at = then;
+	p->us = now - then;
+	p->requests = NextRequest(dc->dpy) - 1 - requests;
+	p->roundtrips = roundtrips - trips;
+	then = now;
+	requests = NextRequest(dc->dpy) - 1;
+	trips = roundtrips;
+}
+
+/* the items are used where they lie in the mapped file, so there is no
+ * per-item work beyond pointing at them */
+void
+readcache(const char *file) {
+	const BinHeader *h;
+	const BinItem *bi;
+	struct stat st;
+	char *map, *strs, *p;
+	size_t i, n;
+	int fd;
+
+	if((fd = open(file, O_RDONLY)) == -1 || fstat(fd, &st) == -1)
+		eprintf("cannot open '%s':", file);
+	if((size_t)st.st_size < sizeof *h
+	|| (map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+		eprintf("cannot map '%s'\n", file);
+	close(fd);
+	h = (const BinHeader *)map;
+	bi = (const BinItem *)(map + sizeof *h);
+	strs = (char *)(bi + h->nitems);
+	if(memcmp(h->magic, BINMAGIC, sizeof h->magic) || h->version != BINVERSION
+	|| sizeof *h + (size_t)h->nitems * sizeof *bi + h->strsize != (size_t)st.st_size
+	|| (h->nitems && (h->longest >= h->nitems || !h->strsize || strs[h->strsize-1])))
+		eprintf("%s: not a dmenu cache of version %d\n", file, BINVERSION);
+
+	if(!(items = calloc(h->nitems + 1, sizeof *items)))
+		eprintf("cannot malloc %u bytes:", (h->nitems + 1) * sizeof *items);
+	for(i = 0; i < h->nitems; i++) {
+		if(bi[i].text >= h->strsize || bi[i].fold >= h->strsize)
+			eprintf("%s: item %u is out of bounds\n", file, i);
+		items[i].text = strs + bi[i].text;
+		items[i].fold = strs + bi[i].fold;
+		if(pinyin && (p = pyshadow(caseins ? items[i].fold : items[i].text))) {
+			n = strlen(p) + 1;
+			n += strlen(p + n) + 1;
+			if(!(items[i].py = malloc(n)))
+				eprintf("cannot malloc %u bytes:", n);
+			memcpy(items[i].py, p, n);
+		}
+	}
+	folded = caseins;
+	if(folded) {
+		fstrncmp = strncmp;
+		fstrstr = strstr;
+	}
+	inputw = h->nitems ? textw(dc, items[h->longest].text) : 0;
+	lines = MIN(lines, h->nitems);
+}
+
 void
 readstdin(void) {
-	char buf[sizeof text], *p, *maxstr = NULL;
-	size_t i, max = 0, size = 0;
-
-	/* read each line from stdin and add it to the item list */
-	for(i = 0; fgets(buf, sizeof buf, stdin); i++) {
-		if(i+1 >= size / sizeof *items)
-			if(!(items = realloc(items, (size += BUFSIZ))))
-				eprintf("cannot realloc %u bytes:", size);
-		if((p = strchr(buf, '\n')))
-			*p = '\0';
-		if(!(items[i].text = strdup(buf)))
-			eprintf("cannot strdup %u bytes:", strlen(buf)+1);
-		if(strlen(items[i].text) > max)
-			max = strlen(maxstr = items[i].text);
+	char buf[sizeof text], in[BUFSIZ], *maxstr = NULL;
+	size_t i = 0, len = 0, max = 0, size = 0;
+	ssize_t j, n;
+	struct pollfd pfd;
+
+	/* read each line from stdin and add it to the item list.  stdin is
+	 * polled while a grab is pending, so that the grab is retried on time
+	 * however slowly the lines come */
+	pfd.fd = STDIN_FILENO;
+	pfd.events = POLLIN;
+	for(;;) {
+		if(grabnext && !grabbed) {
+			n = poll(&pfd, 1, MAX(grabnext - uptime(), 0) / 1000 + 1);
+			grabkeyboard();
+			if(n == 0 || (n < 0 && errno == EINTR))
+				continue;
+		}
+		if((n = read(STDIN_FILENO, in, sizeof in)) < 0) {
+			if(errno == EINTR)
+				continue;
+			eprintf("cannot read stdin:");
+		}
+		/* lines too long for the input field are split, as fgets() did */
+		for(j = 0; j < n || (n == 0 && len > 0); j++) {
+			if(j < n && in[j] != '\n') {
+				buf[len++] = in[j];
+				if(len < sizeof buf - 1)
+					continue;
+			}
+			buf[len] = '\0';
+			len = 0;
+			additem(buf, i, &size);
+			if(strlen(items[i].text) > max)
+				max = strlen(maxstr = items[i].text);
+			i++;
+		}
+		if(n == 0)
+			break;
 	}
 	if(items)
 		items[i].text = NULL;
@@ -504,11 +955,50 @@ readstdin(void) {
 	lines = MIN(lines, i);
 }
 
+/* one JSON object per run, so that reports from many hosts can be gathered */
+void
+report(void) {
+	unsigned long requests = 0, trips = 0;
+	size_t i;
+
+	if(!timing)
+		return;
+	XSetAfterFunction(dc->dpy, NULL);
+	fputc('{', stderr);
+	for(i = 0; i < nphases; i++) {
+		fprintf(stderr, "\"%s\":{\"at\":%ld,\"us\":%ld,\"requests\":%lu,\"roundtrips\":%lu},",
+		        phases[i].name, phases[i].at, phases[i].us,
+		        phases[i].requests, phases[i].roundtrips);
+		requests += phases[i].requests;
+		trips += phases[i].roundtrips;
+	}
+	fprintf(stderr, "\"total\":{\"us\":%ld,\"requests\":%lu,\"roundtrips\":%lu}}\n",
+	        nphases ? phases[nphases-1].at + phases[nphases-1].us : 0, requests, trips);
+	fflush(stderr);
+}
+
 void
 run(void) {
+	Bool imstarted = False;
+	struct pollfd pfd;
 	XEvent ev;
 
-	while(running && !XNextEvent(dc->dpy, &ev)) {
+	while(running) {
+		/* the first frame is out, so the input method can be waited for */
+		grabkeyboard();
+		if(!imstarted && !XPending(dc->dpy)) {
+			imstarted = True;
+			openim();
+		}
+		/* sleep until an event comes or the next grab is due */
+		if(!grabbed && !XPending(dc->dpy)) {
+			pfd.fd = ConnectionNumber(dc->dpy);
+			pfd.events = POLLIN;
+			poll(&pfd, 1, MAX(grabnext - uptime(), 0) / 1000 + 1);
+			continue;
+		}
+		if(XNextEvent(dc->dpy, &ev))
+			break;
 		if(XFilterEvent(&ev, win))
 			continue;
 		switch(ev.type) {
@@ -517,7 +1007,8 @@ run(void) {
 				mapdc(dc, win, mw, mh);
 			break;
 		case KeyPress:
-			keypress(&ev.xkey);
+			if(grabbed)
+				keypress(&ev.xkey);
 			break;
 		case SelectionNotify:
 			if(ev.xselection.property == utf8)
@@ -536,14 +1027,15 @@ setup(void) {
 	int x, y, screen = DefaultScreen(dc->dpy);
 	Window root = RootWindow(dc->dpy, screen);
 	XSetWindowAttributes swa;
-	XIM xim;
+	Atom atoms[AtomLast];
 #ifdef XINERAMA
 	int n;
 	XineramaScreenInfo *info;
 #endif
 
-	clip = XInternAtom(dc->dpy, "CLIPBOARD",   False);
-	utf8 = XInternAtom(dc->dpy, "UTF8_STRING", False);
+	XInternAtoms(dc->dpy, atomnames, AtomLast, False, atoms);
+	clip = atoms[Clipboard];
+	utf8 = atoms[UTF8String];
 
 	/* calculate menu geometry */
 	bh = dc->font.height + 2;
@@ -553,23 +1045,40 @@ setup(void) {
 	if((info = XineramaQueryScreens(dc->dpy, &n))) {
 		int a, j, di, i = 0, area = 0;
 		unsigned int du;
+		unsigned long nl, dl;
+		unsigned char *p = NULL;
+		Atom da;
 		Window w, pw, dw, *dws;
 		XWindowAttributes wa;
 
-		XGetInputFocus(dc->dpy, &w, &di);
-		if(w != root && w != PointerRoot && w != None) {
-			/* find top-level window containing current input focus */
-			do {
-				if(XQueryTree(dc->dpy, (pw = w), &dw, &w, &dws, &du) && dws)
-					XFree(dws);
-			} while(w != root && w != pw);
-			/* find xinerama screen with which the window intersects most */
-			if(XGetWindowAttributes(dc->dpy, pw, &wa))
+		/* dwm publishes the geometry of its selected monitor */
+		if(XGetWindowProperty(dc->dpy, root, atoms[DWMSelMon], 0L, 4L, False, XA_CARDINAL,
+		                      &da, &di, &nl, &dl, &p) == Success && p) {
+			if(nl == 4)
 				for(j = 0; j < n; j++)
-					if((a = INTERSECT(wa.x, wa.y, wa.width, wa.height, info[j])) > area) {
+					if((a = INTERSECT(((long *)p)[0], ((long *)p)[1], ((long *)p)[2],
+					                  ((long *)p)[3], info[j])) > area) {
 						area = a;
 						i = j;
 					}
+			XFree(p);
+		}
+		if(!area) {
+			XGetInputFocus(dc->dpy, &w, &di);
+			if(w != root && w != PointerRoot && w != None) {
+				/* find top-level window containing current input focus */
+				do {
+					if(XQueryTree(dc->dpy, (pw = w), &dw, &w, &dws, &du) && dws)
+						XFree(dws);
+				} while(w != root && w != pw);
+				/* find xinerama screen with which the window intersects most */
+				if(XGetWindowAttributes(dc->dpy, pw, &wa))
+					for(j = 0; j < n; j++)
+						if((a = INTERSECT(wa.x, wa.y, wa.width, wa.height, info[j])) > area) {
+							area = a;
+							i = j;
+						}
+			}
 		}
 		/* no focused window is on screen, so use pointer location instead */
 		if(!area && XQueryPointer(dc->dpy, root, &dw, &dw, &x, &y, &di, &di, &du))
@@ -602,19 +1111,33 @@ setup(void) {
 	                    DefaultVisual(dc->dpy, screen),
 	                    CWOverrideRedirect | CWBackPixel | CWEventMask, &swa);
 
-	/* open input methods */
-	xim = XOpenIM(dc->dpy, NULL, NULL, NULL);
-	xic = XCreateIC(xim, XNInputStyle, XIMPreeditNothing | XIMStatusNothing,
-	                XNClientWindow, win, XNFocusWindow, win, NULL);
-
+	phase("setup");
 	XMapRaised(dc->dpy, win);
 	resizedc(dc, mw, mh);
 	drawmenu();
 }
 
+unsigned int
+tokdist(const char *s, const char *tok, const Pattern *pat) {
+	if(pat && pat->dist > 0)
+		return approxstr(s, pat);
+	return fstrstr(s, tok) ? 0 : 1;
+}
+
+/* microseconds since startup */
+long
+uptime(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec - epoch.tv_sec) * 1000000 + (ts.tv_nsec - epoch.tv_nsec) / 1000;
+}
+
 void
 usage(void) {
-	fputs("usage: dmenu [-b] [-f] [-i] [-l lines] [-p prompt] [-fn font]\n"
-	      "             [-nb color] [-nf color] [-sb color] [-sf color] [-v]\n", stderr);
+	fputs("usage: dmenu [-b] [-f] [-i] [-py] [-r] [-run] [-T] [-a errors]\n"
+	      "             [-c cache] [-l lines] [-p prompt] [-fn font] [-nb color]\n"
+	      "             [-nf color] [-sb color] [-sf color] [-v]\n",
+	      stderr);
 	exit(EXIT_FAILURE);
 }
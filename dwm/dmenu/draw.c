@@ -4,11 +4,174 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include <X11/Xlib.h>
+#include <X11/Xresource.h>
 #include "draw.h"
 
 #define MAX(a, b)  ((a) > (b) ? (a) : (b))
 #define MIN(a, b)  ((a) < (b) ? (a) : (b))
+#define LENGTH(X)  (sizeof (X) / sizeof (X)[0])
+
+#define MAXCACHED  16  /* fonts remembered in the font cache */
+#define MAXFONTS   8   /* the Xft font asked for and its fallbacks */
+#define NWIDTHS    256 /* run widths remembered */
+
+struct FontCache {
+	XftFont *fonts[MAXFONTS];
+	FcChar32 cover[MAXFONTS][0x10000 / 32]; /* BMP codepoints each font has */
+	int nfonts;
+	unsigned char *fontof[0x110000 >> 8];  /* font index + 1 per codepoint, in pages */
+	struct {
+		char *text;
+		size_t len;
+		int font, width;
+	} widths[NWIDTHS];
+};
+
+static int addfont(FontCache *fc, XftFont *font);
+static char *cachedfont(const char *key);
+static void cachefont(const char *key, FcPattern *pat);
+static const char *cachepath(Bool create);
+static unsigned long channel(unsigned short v, unsigned long mask);
+static Bool corename(const char *fontstr);
+static void facecharset(FcPattern *pat);
+static int findfont(DC *dc, FcChar32 c);
+static void fontkey(DC *dc, const char *fontstr, char *key, size_t size);
+static Bool loadcore(DC *dc, const char *fontstr);
+static Bool loadxft(DC *dc, const char *fontstr);
+static Bool parsehex(DC *dc, const char *colstr, XRenderColor *rc);
+static size_t run(DC *dc, const char *text, size_t len, int *font);
+static int runw(DC *dc, int font, const char *text, size_t len);
+
+/* append font to the chain, noting which BMP codepoints it has */
+int
+addfont(FontCache *fc, XftFont *font) {
+	FcChar32 base, next, map[FC_CHARSET_MAP_SIZE];
+	int i;
+
+	for(i = 0; i < fc->nfonts; i++)
+		if(fc->fonts[i] == font)
+			return i;
+	fc->fonts[i] = font;
+	if(font->charset)
+		for(base = FcCharSetFirstPage(font->charset, map, &next);
+		    base != FC_CHARSET_DONE && base < 0x10000;
+		    base = FcCharSetNextPage(font->charset, map, &next))
+			memcpy(&fc->cover[i][base / 32], map, sizeof map);
+	return fc->nfonts++;
+}
+
+/* the pattern remembered for key, or NULL */
+char *
+cachedfont(const char *key) {
+	char buf[BUFSIZ], *p, *ret = NULL;
+	size_t n = strlen(key);
+	FILE *fp;
+
+	if(!(fp = fopen(cachepath(False), "r")))
+		return NULL;
+	while(!ret && fgets(buf, sizeof buf, fp))
+		if(!strncmp(buf, key, n) && buf[n] == '\t' && (p = strchr(buf, '\n'))) {
+			*p = '\0';
+			if(!(ret = strdup(&buf[n+1])))
+				eprintf("cannot strdup %u bytes:", strlen(&buf[n+1])+1);
+		}
+	fclose(fp);
+	return ret;
+}
+
+/* remember pat for key, in front of the other entries; the file is
+ * replaced as a whole, so readers never see it half written */
+void
+cachefont(const char *key, FcPattern *pat) {
+	char buf[BUFSIZ], tmp[BUFSIZ];
+	const char *path;
+	size_t n = strlen(key);
+	FcChar8 *name;
+	FILE *in, *out;
+	int fd, i;
+
+	if(!(path = cachepath(True)) || !(pat = FcPatternDuplicate(pat)))
+		return;
+	/* both are large; loadxft() takes the coverage from fontconfig's own
+	 * cache when it opens the pattern again */
+	FcPatternDel(pat, FC_CHARSET);
+	FcPatternDel(pat, FC_LANG);
+	name = FcNameUnparse(pat);
+	FcPatternDestroy(pat);
+	if(!name)
+		return;
+	snprintf(tmp, sizeof tmp, "%s.XXXXXX", path);
+	if(n + strlen((char *)name) + 2 >= sizeof buf || (fd = mkstemp(tmp)) < 0) {
+		free(name);
+		return;
+	}
+	if(!(out = fdopen(fd, "w"))) {
+		close(fd);
+		unlink(tmp);
+		free(name);
+		return;
+	}
+	fprintf(out, "%s\t%s\n", key, (char *)name);
+	free(name);
+	if((in = fopen(path, "r"))) {
+		for(i = 1; i < MAXCACHED && fgets(buf, sizeof buf, in); )
+			if(strchr(buf, '\n') && (strncmp(buf, key, n) || buf[n] != '\t')) {
+				fputs(buf, out);
+				i++;
+			}
+		fclose(in);
+	}
+	if(fclose(out) == EOF || rename(tmp, path) == -1)
+		unlink(tmp);
+}
+
+/* $XDG_CACHE_HOME/dmenu/fonts, or ~/.cache/dmenu/fonts */
+const char *
+cachepath(Bool create) {
+	static char path[BUFSIZ];
+	const char *dir;
+	char *p;
+
+	if(!path[0]) {
+		if((dir = getenv("XDG_CACHE_HOME")) && *dir)
+			snprintf(path, sizeof path, "%s/dmenu/fonts", dir);
+		else if((dir = getenv("HOME")))
+			snprintf(path, sizeof path, "%s/.cache/dmenu/fonts", dir);
+		else
+			return NULL;
+	}
+	if(create)
+		for(p = strchr(path+1, '/'); p; p = strchr(p+1, '/')) {
+			*p = '\0';
+			mkdir(path, 0700);
+			*p = '/';
+		}
+	return path;
+}
+
+/* scale a 16-bit colour component into the bits of a TrueColor mask */
+unsigned long
+channel(unsigned short v, unsigned long mask) {
+	int shift = 0, bits = 0;
+
+	for(; mask && !(mask & 1); mask >>= 1)
+		shift++;
+	for(; mask & 1; mask >>= 1)
+		bits++;
+	return (unsigned long)(v >> (16 - bits)) << shift;
+}
+
+/* XLFDs, wildcards and aliases such as "fixed" or "9x15" name core fonts;
+ * anything else is taken for a fontconfig pattern */
+Bool
+corename(const char *fontstr) {
+	if(fontstr[0] == '-' || strpbrk(fontstr, "*?"))
+		return True;
+	return fontstr[0] && !fontstr[strspn(fontstr, "abcdefghijklmnopqrstuvwxyz0123456789")];
+}
 
 void
 drawrect(DC *dc, int x, int y, unsigned int w, unsigned int h, Bool fill, unsigned long color) {
@@ -38,15 +201,20 @@ drawtext(DC *dc, const char *text, ColorSet *col) {
 
 void
 drawtextn(DC *dc, const char *text, size_t n, ColorSet *col) {
-	int x = dc->x + dc->font.height/2;
+	int i, x = dc->x + dc->font.height/2;
 	int y = dc->y + dc->font.ascent+1;
+	size_t len;
 
 	XSetForeground(dc->dpy, dc->gc, col->FG);
 	if(dc->font.xft_font) {
 		if (!dc->xftdraw)
 			eprintf("error, xft drawable does not exist");
-		XftDrawStringUtf8(dc->xftdraw, &col->FG_xft,
-			dc->font.xft_font, x, y, (unsigned char*)text, n);
+		for(; n > 0; text += len, n -= len) {
+			len = run(dc, text, n, &i);
+			XftDrawStringUtf8(dc->xftdraw, &col->FG_xft,
+				dc->font.cache->fonts[i], x, y, (const FcChar8 *)text, len);
+			x += runw(dc, i, text, len);
+		}
 	} else if(dc->font.set) {
 		XmbDrawString(dc->dpy, dc->canvas, dc->font.set, dc->gc, x, y, text, n);
 	} else {
@@ -70,6 +238,115 @@ eprintf(const char *fmt, ...) {
 	exit(EXIT_FAILURE);
 }
 
+/* give pat the coverage fontconfig has cached for its face.  Without one
+ * Xft builds it from the font's character map, which for a CJK font costs
+ * about as much as the match the font cache saves */
+void
+facecharset(FcPattern *pat) {
+	FcPattern *face;
+	FcObjectSet *os;
+	FcFontSet *fs;
+	FcCharSet *cs;
+	FcChar8 *file;
+	int index = 0;
+
+	if(FcPatternGetString(pat, FC_FILE, 0, &file) != FcResultMatch
+	|| !(face = FcPatternCreate()))
+		return;
+	FcPatternGetInteger(pat, FC_INDEX, 0, &index);
+	FcPatternAddString(face, FC_FILE, file);
+	FcPatternAddInteger(face, FC_INDEX, index);
+	if((os = FcObjectSetBuild(FC_CHARSET, (char *)NULL))) {
+		if((fs = FcFontList(NULL, face, os))) {
+			if(fs->nfont > 0
+			&& FcPatternGetCharSet(fs->fonts[0], FC_CHARSET, 0, &cs) == FcResultMatch)
+				FcPatternAddCharSet(pat, FC_CHARSET, cs);
+			FcFontSetDestroy(fs);
+		}
+		FcObjectSetDestroy(os);
+	}
+	FcPatternDestroy(face);
+}
+
+/* the font to draw c with: the first in the chain which has it, or a new
+ * fallback from fontconfig; either way the answer is kept for next time */
+int
+findfont(DC *dc, FcChar32 c) {
+	FontCache *fc = dc->font.cache;
+	unsigned char **page = &fc->fontof[c >> 8];
+	FcPattern *pat, *match;
+	FcCharSet *cs;
+	FcResult result;
+	XftFont *font = NULL;
+	double size;
+	int i, n;
+
+	if(*page && (*page)[c & 0xff])
+		return (*page)[c & 0xff] - 1;
+	for(i = 0; i < fc->nfonts; i++)
+		if(c < 0x10000 ? fc->cover[i][c / 32] & (1U << (c % 32))
+		               : XftCharExists(dc->dpy, fc->fonts[i], c))
+			break;
+	if(i == fc->nfonts && fc->nfonts < MAXFONTS && (pat = FcPatternCreate())) {
+		/* ask for the style of the primary font, but with c in it */
+		if(FcPatternGetDouble(fc->fonts[0]->pattern, FC_PIXEL_SIZE, 0, &size) == FcResultMatch)
+			FcPatternAddDouble(pat, FC_PIXEL_SIZE, size);
+		if(FcPatternGetInteger(fc->fonts[0]->pattern, FC_WEIGHT, 0, &n) == FcResultMatch)
+			FcPatternAddInteger(pat, FC_WEIGHT, n);
+		if(FcPatternGetInteger(fc->fonts[0]->pattern, FC_SLANT, 0, &n) == FcResultMatch)
+			FcPatternAddInteger(pat, FC_SLANT, n);
+		if((cs = FcCharSetCreate())) {
+			FcCharSetAddChar(cs, c);
+			FcPatternAddCharSet(pat, FC_CHARSET, cs);
+			FcCharSetDestroy(cs);
+		}
+		FcPatternAddBool(pat, FC_SCALABLE, FcTrue);
+		if((match = XftFontMatch(dc->dpy, DefaultScreen(dc->dpy), pat, &result))
+		&& !(font = XftFontOpenPattern(dc->dpy, match)))
+			FcPatternDestroy(match);
+		FcPatternDestroy(pat);
+		if(font && XftCharExists(dc->dpy, font, c)) {
+			n = fc->nfonts;
+			if((i = addfont(fc, font)) < n)
+				XftFontClose(dc->dpy, font); /* Xft handed out one we had */
+		}
+		else {
+			if(font)
+				XftFontClose(dc->dpy, font);
+			i = fc->nfonts;
+		}
+	}
+	if(i == fc->nfonts)
+		i = 0; /* nobody has it: draw the primary font's missing glyph */
+	if(!*page && !(*page = calloc(256, 1)))
+		eprintf("cannot malloc %u bytes:", 256);
+	(*page)[c & 0xff] = i + 1;
+	return i;
+}
+
+/* the cache key: the newest fontconfig configuration file and the X resources,
+ * which hold Xft's defaults, decide what a font name matches */
+void
+fontkey(DC *dc, const char *fontstr, char *key, size_t size) {
+	unsigned long h = 5381;
+	time_t t = 0;
+	struct stat st;
+	FcStrList *files;
+	FcChar8 *f;
+	const char *p;
+
+	if((files = FcConfigGetConfigFiles(NULL))) {
+		while((f = FcStrListNext(files)))
+			if(stat((char *)f, &st) == 0 && st.st_mtime > t)
+				t = st.st_mtime;
+		FcStrListDone(files);
+	}
+	if((p = XResourceManagerString(dc->dpy)))
+		for(; *p; p++)
+			h = h * 33 + (unsigned char)*p;
+	snprintf(key, size, "%ld %lx %s", (long)t, h, fontstr);
+}
+
 void
 freecol(DC *dc, ColorSet *col) {
     if(col) {
@@ -82,10 +359,21 @@ freecol(DC *dc, ColorSet *col) {
 
 void
 freedc(DC *dc) {
+	int i;
+
     if(dc->font.xft_font) {
         XftFontClose(dc->dpy, dc->font.xft_font);
         XftDrawDestroy(dc->xftdraw);
     }
+	if(dc->font.cache) {
+		for(i = 1; i < dc->font.cache->nfonts; i++)
+			XftFontClose(dc->dpy, dc->font.cache->fonts[i]);
+		for(i = 0; i < LENGTH(dc->font.cache->fontof); i++)
+			free(dc->font.cache->fontof[i]);
+		for(i = 0; i < NWIDTHS; i++)
+			free(dc->font.cache->widths[i].text);
+		free(dc->font.cache);
+	}
 	if(dc->font.set)
 		XFreeFontSet(dc->dpy, dc->font.set);
     if(dc->font.xfont)
@@ -103,8 +391,13 @@ freedc(DC *dc) {
 unsigned long
 getcolor(DC *dc, const char *colstr) {
 	Colormap cmap = DefaultColormap(dc->dpy, DefaultScreen(dc->dpy));
+	Visual *vis = DefaultVisual(dc->dpy, DefaultScreen(dc->dpy));
 	XColor color;
+	XRenderColor rc;
 
+	if(parsehex(dc, colstr, &rc))
+		return channel(rc.red, vis->red_mask) | channel(rc.green, vis->green_mask)
+		     | channel(rc.blue, vis->blue_mask);
 	if(!XAllocNamedColor(dc->dpy, cmap, colstr, &color, &color))
 		eprintf("cannot allocate color '%s'\n", colstr);
 	return color.pixel;
@@ -113,13 +406,18 @@ getcolor(DC *dc, const char *colstr) {
 ColorSet *
 initcolor(DC *dc, const char * foreground, const char * background) {
 	ColorSet * col = (ColorSet *)malloc(sizeof(ColorSet));
+	XRenderColor rc;
+
 	if(!col)
 		eprintf("error, cannot allocate memory for color set");
 	col->BG = getcolor(dc, background);
 	col->FG = getcolor(dc, foreground);
 	if(dc->font.xft_font)
-		if(!XftColorAllocName(dc->dpy, DefaultVisual(dc->dpy, DefaultScreen(dc->dpy)),
-			DefaultColormap(dc->dpy, DefaultScreen(dc->dpy)), foreground, &col->FG_xft))
+		if(!(parsehex(dc, foreground, &rc)
+		     ? XftColorAllocValue(dc->dpy, DefaultVisual(dc->dpy, DefaultScreen(dc->dpy)),
+			DefaultColormap(dc->dpy, DefaultScreen(dc->dpy)), &rc, &col->FG_xft)
+		     : XftColorAllocName(dc->dpy, DefaultVisual(dc->dpy, DefaultScreen(dc->dpy)),
+			DefaultColormap(dc->dpy, DefaultScreen(dc->dpy)), foreground, &col->FG_xft)))
 			eprintf("error, cannot allocate xft font color '%s'\n", foreground);
 	return col;
 }
@@ -142,6 +440,15 @@ initdc(void) {
 
 void
 initfont(DC *dc, const char *fontstr) {
+	/* try the kind of font the name looks like first */
+	if(corename(fontstr) ? !loadcore(dc, fontstr) && !loadxft(dc, fontstr)
+	                     : !loadxft(dc, fontstr) && !loadcore(dc, fontstr))
+		eprintf("cannot load font '%s'\n", fontstr);
+	dc->font.height = dc->font.ascent + dc->font.descent;
+}
+
+Bool
+loadcore(DC *dc, const char *fontstr) {
 	char *def, **missing, **names;
 	int i, n;
 	XFontStruct **xfonts;
@@ -154,21 +461,55 @@ initfont(DC *dc, const char *fontstr) {
 			dc->font.descent = MAX(dc->font.descent, xfonts[i]->descent);
 			dc->font.width   = MAX(dc->font.width,   xfonts[i]->max_bounds.width);
 		}
-    } else if((dc->font.xfont = XLoadQueryFont(dc->dpy, fontstr))) {
+	} else if((dc->font.xfont = XLoadQueryFont(dc->dpy, fontstr))) {
 		dc->font.ascent = dc->font.xfont->ascent;
 		dc->font.descent = dc->font.xfont->descent;
 		dc->font.width   = dc->font.xfont->max_bounds.width;
-	} else if((dc->font.xft_font = XftFontOpenName(dc->dpy, DefaultScreen(dc->dpy), fontstr))) {
-		dc->font.ascent = dc->font.xft_font->ascent;
-		dc->font.descent = dc->font.xft_font->descent;
-		dc->font.width = dc->font.xft_font->max_advance_width;
-	} else {
-		eprintf("cannot load font '%s'\n", fontstr);
 	}
 	if(missing)
 		XFreeStringList(missing);
-	dc->font.height = dc->font.ascent + dc->font.descent;
-	return;
+	return dc->font.set || dc->font.xfont;
+}
+
+/* like XftFontOpenName, but a pattern matched before is opened without
+ * asking fontconfig to match it again */
+Bool
+loadxft(DC *dc, const char *fontstr) {
+	char key[BUFSIZ], *name;
+	Bool cache = !strpbrk(fontstr, "\t\n"); /* these delimit cache entries */
+	FcPattern *pat, *match;
+	FcResult result;
+
+	fontkey(dc, fontstr, key, sizeof key);
+	if(cache && (name = cachedfont(key))) {
+		if((pat = FcNameParse((FcChar8 *)name))) {
+			facecharset(pat);
+			if(!(dc->font.xft_font = XftFontOpenPattern(dc->dpy, pat)))
+				FcPatternDestroy(pat);
+		}
+		free(name);
+	}
+	if(!dc->font.xft_font) {
+		if(!(pat = FcNameParse((FcChar8 *)fontstr)))
+			return False;
+		match = XftFontMatch(dc->dpy, DefaultScreen(dc->dpy), pat, &result);
+		FcPatternDestroy(pat);
+		if(!match)
+			return False;
+		if(!(dc->font.xft_font = XftFontOpenPattern(dc->dpy, match))) {
+			FcPatternDestroy(match);
+			return False;
+		}
+		if(cache)
+			cachefont(key, match);
+	}
+	if(!(dc->font.cache = calloc(1, sizeof *dc->font.cache)))
+		eprintf("cannot malloc %u bytes:", sizeof *dc->font.cache);
+	addfont(dc->font.cache, dc->font.xft_font);
+	dc->font.ascent = dc->font.xft_font->ascent;
+	dc->font.descent = dc->font.xft_font->descent;
+	dc->font.width = dc->font.xft_font->max_advance_width;
+	return True;
 }
 
 void
@@ -176,6 +517,30 @@ mapdc(DC *dc, Window win, unsigned int w, unsigned int h) {
 	XCopyArea(dc->dpy, dc->canvas, win, dc->gc, 0, 0, w, h, 0, 0);
 }
 
+/* #rgb and #rrggbb colours map straight to TrueColor pixels, which spares a
+ * round trip to the server for each of them */
+Bool
+parsehex(DC *dc, const char *colstr, XRenderColor *rc) {
+	char buf[3];
+	size_t i, n = strlen(colstr);
+	unsigned short *v[3];
+
+	if(DefaultVisual(dc->dpy, DefaultScreen(dc->dpy))->class != TrueColor
+	|| colstr[0] != '#' || (n != 4 && n != 7)
+	|| strspn(colstr+1, "0123456789abcdefABCDEF") != n-1)
+		return False;
+	n = (n-1) / 3;
+	v[0] = &rc->red; v[1] = &rc->green; v[2] = &rc->blue;
+	for(i = 0; i < 3; i++) {
+		memcpy(buf, &colstr[1 + i*n], n);
+		buf[n] = '\0';
+		/* like XParseColor, the digits given are the most significant */
+		*v[i] = strtoul(buf, NULL, 16) << (16 - 4*n);
+	}
+	rc->alpha = 0xffff;
+	return True;
+}
+
 void
 resizedc(DC *dc, unsigned int w, unsigned int h) {
 	int screen = DefaultScreen(dc->dpy);
@@ -193,12 +558,63 @@ resizedc(DC *dc, unsigned int w, unsigned int h) {
 	}
 }
 
+/* the length of the longest prefix of text drawn with a single font */
+size_t
+run(DC *dc, const char *text, size_t len, int *font) {
+	FcChar32 c;
+	size_t n = 0;
+	int i;
+
+	while(n < len) {
+		if((i = FcUtf8ToUcs4((const FcChar8 *)&text[n], &c, len - n)) <= 0 || c > 0x10ffff) {
+			c = 0xfffd; /* invalid, so it goes with the primary font */
+			i = 1;
+		}
+		if(n == 0)
+			*font = c == 0xfffd ? 0 : findfont(dc, c);
+		else if((c == 0xfffd ? 0 : findfont(dc, c)) != *font)
+			break;
+		n += i;
+	}
+	return n;
+}
+
+/* widths are measured once per run of text, as menus are redrawn often */
+int
+runw(DC *dc, int font, const char *text, size_t len) {
+	FontCache *fc = dc->font.cache;
+	unsigned int h = 2166136261U + font;
+	XGlyphInfo gi;
+	size_t i;
+
+	for(i = 0; i < len; i++)
+		h = (h ^ (unsigned char)text[i]) * 16777619U;
+	i = h % NWIDTHS;
+	if(fc->widths[i].text && fc->widths[i].font == font && fc->widths[i].len == len
+	&& !memcmp(fc->widths[i].text, text, len))
+		return fc->widths[i].width;
+	XftTextExtentsUtf8(dc->dpy, fc->fonts[font], (const FcChar8 *)text, len, &gi);
+	free(fc->widths[i].text);
+	if((fc->widths[i].text = malloc(len))) {
+		memcpy(fc->widths[i].text, text, len);
+		fc->widths[i].len = len;
+		fc->widths[i].font = font;
+		fc->widths[i].width = gi.xOff;
+	}
+	return gi.xOff;
+}
+
 int
 textnw(DC *dc, const char *text, size_t len) {
 	if(dc->font.xft_font) {
-		XGlyphInfo gi;
-		XftTextExtentsUtf8(dc->dpy, dc->font.xft_font, (const FcChar8*)text, len, &gi);
-		return gi.width;
+		int i, w = 0;
+		size_t n;
+
+		for(; len > 0; text += n, len -= n) {
+			n = run(dc, text, len, &i);
+			w += runw(dc, i, text, n);
+		}
+		return w;
 	} else if(dc->font.set) {
 		XRectangle r;
 		XmbTextExtents(dc->font.set, text, len, NULL, &r);
@@ -2,6 +2,8 @@
 
 #include <X11/Xft/Xft.h>
 
+typedef struct FontCache FontCache;
+
 typedef struct {
 	int x, y, w, h;
 	Bool invert;
@@ -17,6 +19,7 @@ typedef struct {
 		XFontSet set;
 		XFontStruct *xfont;
 		XftFont *xft_font;
+		FontCache *cache;   /* fallback fonts for glyphs xft_font lacks */
 	} font;
 } DC;  /* draw context */
 
@@ -0,0 +1,1169 @@
+/*
+ * The executables in $PATH, for dmenu_path and "dmenu -run".
+ *
+ * Each set of directories in $PATH has its own cache slot in
+ * $XDG_CACHE_HOME/dmenu/path (or ~/.cache/dmenu/path), named after a hash of
+ * the set, so that shells with different PATHs do not spoil each other's
+ * cache; only the MAX_SLOTS most recently used are kept.  A slot is the list
+ * itself, a ".dirs" file to remember what each directory held, so only changed
+ * ones are read again, and a ".bin" file which holds the same list in the
+ * format of bincache.h, for dmenu to map.
+ *
+ * Directories are read with getdents64 and every candidate is stat()ed
+ * relative to its directory, in one batch of statx requests through
+ * io_uring, or by a few threads where io_uring is not available.
+ *
+ * This file is released under the X11 license, like dmenu_path.
+ */
+
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <malloc.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/inotify.h>
+#include <poll.h>
+#include <linux/io_uring.h>
+#include <linux/stat.h>
+#include "bincache.h"
+#include "path.h"
+
+#define RING_ENTRIES 256
+#define MAX_THREADS 8
+#define SETTLE_MS 100		/* how long -d waits for a burst of changes to end */
+#define INDEX_VERSION "dmenu_path index 2"	/* bumped with BINVERSION */
+#define MAX_SLOTS 8		/* how many PATHs to keep caches for */
+#define WATCH_EVENTS (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB \
+	| IN_CLOSE_WRITE | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR)
+#define PARENT_EVENTS (IN_CREATE | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF \
+	| IN_ONLYDIR | IN_MASK_ADD)
+
+/* a directory entry which may turn out to be an executable */
+struct entry
+{
+    int dir;			/* index into dirfds */
+    size_t name;		/* offset into names */
+    int ok;			/* stat succeeded */
+    mode_t mode;
+    uid_t uid;
+    gid_t gid;
+};
+
+/* a PATH directory and the executables last found in it */
+struct dir
+{
+    const char* path;
+    int wd;			/* inotify watch, or -1 */
+    int pwd;			/* watch on the nearest existing parent while
+				   missing, or -1 */
+    int dirty;			/* must be scanned again */
+    unsigned long long dev, ino;	/* as of the last scan, all 0 if missing */
+    long long sec, nsec;	/* mtime */
+    char** progs;		/* sorted */
+    size_t nprogs;
+    size_t allocated;
+};
+
+struct linux_dirent64
+{
+    unsigned long long d_ino;
+    long long d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
+static uid_t uid;
+static gid_t gid;
+static gid_t* groups;
+static int ngroups;
+static char* slot_dir;
+static char* cache_path;
+static char* index_path;
+static char* bin_path;
+
+static int* dirfds;
+static size_t* dirowners;	/* the struct dir each dirfd belongs to */
+static size_t ndirfds;
+static char* names;
+static size_t names_used, names_allocated;
+static struct entry* entries;
+static size_t nentries, entries_allocated;
+static size_t next_entry;	/* the next one for a thread to stat */
+
+static char** paths;
+static struct dir* dirs;
+static size_t ndirs;
+static size_t stale;		/* as load_index found it */
+
+static void die(const char* msg)
+{
+    perror(msg);
+    exit(EXIT_FAILURE);
+}
+
+/* $XDG_CACHE_HOME/dmenu/path, or ~/.cache/dmenu/path, created if need be */
+static char* get_slot_dir()
+{
+    const char* base = getenv("XDG_CACHE_HOME");
+    const char* sub = "/dmenu/path";
+    char* path;
+    char* p;
+
+    if (base == NULL || *base == '\0')
+    {
+	base = getenv("HOME");
+	sub = "/.cache/dmenu/path";
+    }
+    if (base == NULL)
+	die("getenv");
+    path = (char*)malloc(strlen(base) + strlen(sub) + 1);
+    if (path == NULL)
+	die("malloc");
+    strcpy(path, base);
+    strcat(path, sub);
+    for (p = strchr(path + 1, '/'); p != NULL; p = strchr(p + 1, '/'))
+    {
+	*p = '\0';
+	mkdir(path, 0700);
+	*p = '/';
+    }
+    mkdir(path, 0700);
+    return path;
+}
+
+/* the slot for a sorted list of directories, so that neither their order in
+ * PATH nor repeated entries make a difference */
+static char* get_cache_path(char** paths)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    const char* p;
+    char* path;
+    size_t i;
+
+    for (i = 0; paths[i] != NULL; i++)
+	for (p = paths[i]; ; p++)
+	{
+	    hash = (hash ^ (unsigned char)*p) * 1099511628211ULL;
+	    if (*p == '\0')
+		break;
+	}
+    path = (char*)malloc(strlen(slot_dir) + 18);
+    if (path == NULL)
+	die("malloc");
+    sprintf(path, "%s/%016llx", slot_dir, hash);
+    return path;
+}
+
+/* a file next to the cache, named after it */
+static char* get_cache_sibling(const char* suffix)
+{
+    char* path = (char*)malloc(strlen(cache_path) + strlen(suffix) + 1);
+    if (path == NULL)
+	die("malloc");
+    strcpy(path, cache_path);
+    strcat(path, suffix);
+    return path;
+}
+
+static char* get_PATH()
+{
+    const char* path = getenv("PATH");
+    char* copy_path;
+    if (path == NULL)
+	die("getenv");
+
+    copy_path = strdup(path);
+    return copy_path;
+}
+
+static void split_PATH(char* PATH, char*** dirs_in)
+{
+    char** dirs;
+    const char* dir = strtok(PATH, ":");
+    size_t i = 0, len;
+    size_t allocated = 10;
+    dirs = (char**)malloc(sizeof(char*) * allocated);
+    if (dirs == NULL)
+	die("malloc");
+
+    while (dir != NULL)
+    {
+	dirs[i] = (char*)malloc(strlen(dir) + 1);
+	if (dirs[i] == NULL)
+	    die("malloc");
+	strcpy(dirs[i], dir);
+	/* "/bin/" is "/bin", as far as the cache slot goes */
+	for (len = strlen(dirs[i]); len > 1 && dirs[i][len - 1] == '/'; len--)
+	    dirs[i][len - 1] = '\0';
+	dir = strtok(NULL, ":");
+	i++;
+	if (i == allocated)
+	{
+	    allocated *= 2;
+	    dirs = (char**)realloc(dirs, allocated * sizeof(char**));
+	    if (dirs == NULL)
+		die("realloc");
+	}
+    }
+    dirs[i] = NULL;
+
+    *dirs_in = dirs;
+}
+
+static void free_charpp(char** in)
+{
+    char** ptr = in;
+    while (*ptr != NULL)
+    {
+	free(*ptr);
+	ptr++;
+    }
+    free(in);
+}
+
+void path_print(char** in, FILE* out)
+{
+    char** ptr = in;
+    while (*ptr != NULL)
+    {
+	fputs(*ptr, out);
+	fputc('\n', out);
+	ptr++;
+    }
+}
+
+static size_t count_charpp(char** in)
+{
+    char** ptr = in;
+    size_t count = 0;
+    while (*ptr != NULL)
+    {
+	count++;
+	ptr++;
+    }
+    return count;
+}
+
+static int isexecutable(mode_t mode, uid_t owner, gid_t group)
+{
+    int i;
+
+    if (!S_ISREG(mode)) /* this catches regular files and symlinks as well */
+	return 0;
+    if ((owner == uid && (mode & S_IXUSR) != 0)
+	    || (owner != uid && group != gid && (mode & S_IXOTH) != 0))
+    {
+	return 1;
+    }
+
+    /* check secondary groups */
+    if (mode & S_IXGRP)
+    {
+	for (i = 0; i < ngroups; i++)
+	    if (owner != uid /* for group to match, user must not match. */
+		    && group == groups[i])
+		return 1;
+    }
+
+    return 0;
+}
+
+static void add(const char* prog, struct dir* dir)
+{
+    if (dir->nprogs == dir->allocated)
+    {
+	dir->allocated = dir->allocated == 0 ? 256 : dir->allocated * 2;
+	dir->progs = (char**)realloc(dir->progs, sizeof(char*) * dir->allocated);
+	if (dir->progs == NULL)
+	    die("realloc");
+    }
+
+    dir->progs[dir->nprogs] = (char*)malloc(strlen(prog) + 1);
+    if (dir->progs[dir->nprogs] == NULL)
+	die("malloc");
+    strcpy(dir->progs[dir->nprogs], prog);
+    dir->nprogs++;
+}
+
+static void add_entry(int dir, const char* name)
+{
+    size_t len = strlen(name) + 1;
+
+    if (names_used + len > names_allocated)
+    {
+	names_allocated = names_allocated == 0 ? 65536 : names_allocated * 2;
+	if (names_used + len > names_allocated)
+	    names_allocated = names_used + len;
+	names = (char*)realloc(names, names_allocated);
+	if (names == NULL)
+	    die("realloc");
+    }
+    if (nentries == entries_allocated)
+    {
+	entries_allocated = entries_allocated == 0 ? 1024 : entries_allocated * 2;
+	entries = (struct entry*)realloc(entries, sizeof(struct entry) * entries_allocated);
+	if (entries == NULL)
+	    die("realloc");
+    }
+    memcpy(names + names_used, name, len);
+    entries[nentries].dir = dir;
+    entries[nentries].name = names_used;
+    entries[nentries].ok = 0;
+    nentries++;
+    names_used += len;
+}
+
+static void refresh_path(const char* path, size_t owner)
+{
+    long buf[4096];
+    struct linux_dirent64* dp;
+    long n, pos;
+    int fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+	if (errno != ENOENT)
+	    perror("open");
+	return;
+    }
+    dirfds = (int*)realloc(dirfds, sizeof(int) * (ndirfds + 1));
+    dirowners = (size_t*)realloc(dirowners, sizeof(size_t) * (ndirfds + 1));
+    if (dirfds == NULL || dirowners == NULL)
+	die("realloc");
+    dirfds[ndirfds] = fd;
+    dirowners[ndirfds] = owner;
+
+    while ((n = syscall(SYS_getdents64, fd, buf, sizeof(buf))) > 0)
+    {
+	for (pos = 0; pos < n; pos += dp->d_reclen)
+	{
+	    dp = (struct linux_dirent64*)((char*)buf + pos);
+	    if (strcmp(dp->d_name, ".") == 0 || strcmp(dp->d_name, "..") == 0)
+		continue;
+	    /* stat() follows links, so nothing else can be a regular file */
+	    if (dp->d_type != DT_REG && dp->d_type != DT_LNK && dp->d_type != DT_UNKNOWN)
+		continue;
+	    add_entry(ndirfds, dp->d_name);
+	}
+    }
+    if (n < 0)
+	perror("getdents64");
+    ndirfds++;
+}
+
+/* returns 0 if io_uring or its statx are not there, and the threads must do */
+static int stat_uring(void)
+{
+    struct io_uring_params p;
+    struct io_uring_sqe* sqes;
+    struct io_uring_sqe* sqe;
+    struct io_uring_cqe* cqes;
+    struct io_uring_cqe* cqe;
+    struct statx* stx;
+    struct statx* st;
+    struct entry* e;
+    unsigned* free_slots;
+    unsigned nfree;
+    unsigned *sq_tail, *sq_mask, *sq_array, *cq_head, *cq_tail, *cq_mask;
+    unsigned head, tail, n, wait;
+    void* sq_ring = MAP_FAILED;
+    void* cq_ring = MAP_FAILED;
+    size_t sq_len, cq_len, sqes_len, submitted = 0, completed = 0;
+    int fd, ret = 0;
+
+    memset(&p, 0, sizeof(p));
+    fd = syscall(__NR_io_uring_setup, RING_ENTRIES, &p);
+    if (fd < 0)
+	return 0;
+    sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+	sq_len = cq_len = sq_len > cq_len ? sq_len : cq_len;
+    sq_ring = mmap(NULL, sq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+	    fd, IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED)
+	goto out;
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+	cq_ring = sq_ring;
+    else if ((cq_ring = mmap(NULL, cq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+		    fd, IORING_OFF_CQ_RING)) == MAP_FAILED)
+	goto out;
+    sqes = (struct io_uring_sqe*)mmap(NULL, sqes_len, PROT_READ | PROT_WRITE,
+	    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+	goto out;
+    stx = (struct statx*)malloc(sizeof(struct statx) * p.sq_entries);
+    free_slots = (unsigned*)malloc(sizeof(unsigned) * p.sq_entries);
+    if (stx == NULL || free_slots == NULL)
+	die("malloc");
+    for (nfree = 0; nfree < p.sq_entries; nfree++)
+	free_slots[nfree] = nfree;
+
+    sq_tail = (unsigned*)((char*)sq_ring + p.sq_off.tail);
+    sq_mask = (unsigned*)((char*)sq_ring + p.sq_off.ring_mask);
+    sq_array = (unsigned*)((char*)sq_ring + p.sq_off.array);
+    cq_head = (unsigned*)((char*)cq_ring + p.cq_off.head);
+    cq_tail = (unsigned*)((char*)cq_ring + p.cq_off.tail);
+    cq_mask = (unsigned*)((char*)cq_ring + p.cq_off.ring_mask);
+    cqes = (struct io_uring_cqe*)((char*)cq_ring + p.cq_off.cqes);
+
+    ret = 1;
+    while (completed < nentries)
+    {
+	/* keep at most sq_entries in flight, each with its own statx buffer;
+	 * they complete in any order, so the buffers are handed out from a
+	 * free list, and user_data says which entry and buffer it was */
+	tail = *sq_tail;
+	for (n = 0; submitted < nentries && nfree > 0; n++)
+	{
+	    sqe = &sqes[tail & *sq_mask];
+	    memset(sqe, 0, sizeof(*sqe));
+	    sqe->opcode = IORING_OP_STATX;
+	    sqe->fd = dirfds[entries[submitted].dir];
+	    sqe->addr = (unsigned long)(names + entries[submitted].name);
+	    sqe->len = STATX_TYPE | STATX_MODE | STATX_UID | STATX_GID;
+	    sqe->off = (unsigned long)&stx[free_slots[--nfree]];
+	    sqe->user_data = (unsigned long long)submitted * p.sq_entries + free_slots[nfree];
+	    sq_array[tail & *sq_mask] = tail & *sq_mask;
+	    tail++;
+	    submitted++;
+	}
+	__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+	/* wait for half the ring, or for what is left at the end, so that
+	 * each enter reaps and refills a batch instead of a single entry */
+	wait = submitted - completed;
+	if (wait > p.sq_entries / 2)
+	    wait = p.sq_entries / 2;
+	if (syscall(__NR_io_uring_enter, fd, n, wait, IORING_ENTER_GETEVENTS, NULL, 0) < 0)
+	{
+	    if (errno == EINTR)
+		continue;
+	    ret = 0;
+	    break;
+	}
+
+	for (head = *cq_head; head != __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE); head++)
+	{
+	    cqe = &cqes[head & *cq_mask];
+	    e = &entries[cqe->user_data / p.sq_entries];
+	    st = &stx[cqe->user_data % p.sq_entries];
+	    if (cqe->res == -EINVAL) /* kernels before 5.6 know no IORING_OP_STATX */
+		ret = 0;
+	    else if (cqe->res == 0)
+	    {
+		e->ok = 1;
+		e->mode = st->stx_mode;
+		e->uid = st->stx_uid;
+		e->gid = st->stx_gid;
+	    }
+	    free_slots[nfree++] = cqe->user_data % p.sq_entries;
+	    completed++;
+	}
+	__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+    }
+    free(stx);
+    free(free_slots);
+    munmap(sqes, sqes_len);
+
+out:
+    if (cq_ring != MAP_FAILED && cq_ring != sq_ring)
+	munmap(cq_ring, cq_len);
+    if (sq_ring != MAP_FAILED)
+	munmap(sq_ring, sq_len);
+    close(fd);
+    return ret;
+}
+
+static void* stat_worker(void* unused)
+{
+    struct stat st;
+    struct entry* e;
+    size_t i;
+
+    while ((i = __sync_fetch_and_add(&next_entry, 1)) < nentries)
+    {
+	e = &entries[i];
+	if (fstatat(dirfds[e->dir], names + e->name, &st, 0) == 0)
+	{
+	    e->ok = 1;
+	    e->mode = st.st_mode;
+	    e->uid = st.st_uid;
+	    e->gid = st.st_gid;
+	}
+    }
+    return NULL;
+}
+
+static void stat_threads(void)
+{
+    pthread_t threads[MAX_THREADS];
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    long i, started;
+
+    if (n > MAX_THREADS)
+	n = MAX_THREADS;
+    if (n > (long)(nentries / 256) + 1) /* not worth a thread */
+	n = nentries / 256 + 1;
+    next_entry = 0;
+    for (started = 1; started < n; started++)
+	if (pthread_create(&threads[started], NULL, stat_worker, NULL) != 0)
+	    break;
+    stat_worker(NULL);
+    for (i = 1; i < started; i++)
+	pthread_join(threads[i], NULL);
+}
+
+static void stat_all(void)
+{
+    size_t i;
+
+    if (stat_uring())
+	return;
+    for (i = 0; i < nentries; i++)
+	entries[i].ok = 0;
+    stat_threads();
+}
+
+static int compare(const void* a, const void* b)
+{
+    return strcmp(*(const char**)a, *(const char**)b);
+}
+
+static void sort(char*** progs)
+{
+    qsort(*progs, count_charpp(*progs), sizeof(*progs), compare);
+}
+
+static void uniq(char*** progs)
+{
+    char** progs_new;
+    char** ptr_1 = *progs;
+    char** ptr_2 = ptr_1 + 1;
+    unsigned long i = 0;;
+
+    progs_new = (char**)malloc(sizeof(char*) * (count_charpp(*progs) + 1));
+    if (progs_new == NULL)
+	die("malloc");
+
+    while (*ptr_1 != NULL)
+    {
+	while (*ptr_2 != NULL && strcmp(*ptr_1, *ptr_2) == 0)
+	{
+	    free(*ptr_2);
+	    ptr_2++;
+	}
+	progs_new[i] = *ptr_1;
+	i++;
+	ptr_1 = ptr_2;
+	ptr_2++;
+    }
+    progs_new[i] = NULL;
+
+    free(*progs);
+
+    *progs = progs_new;
+}
+
+static void stat_dir(struct dir* dir)
+{
+    struct stat st;
+
+    if (stat(dir->path, &st) != 0)
+    {
+	if (errno != ENOENT)
+	    perror("stat");
+	dir->dev = dir->ino = 0;
+	dir->sec = dir->nsec = 0;
+	return;
+    }
+    dir->dev = st.st_dev;
+    dir->ino = st.st_ino;
+    dir->sec = st.st_mtim.tv_sec;
+    dir->nsec = st.st_mtim.tv_nsec;
+}
+
+/* rescan the directories marked dirty */
+static void scan(struct dir* dirs, size_t ndirs)
+{
+    struct entry* e;
+    size_t i;
+
+    nentries = names_used = ndirfds = 0;
+    for (i = 0; i < ndirs; i++)
+	if (dirs[i].dirty)
+	{
+	    while (dirs[i].nprogs > 0)
+		free(dirs[i].progs[--dirs[i].nprogs]);
+	    /* a change after this is seen by the next run */
+	    stat_dir(&dirs[i]);
+	    refresh_path(dirs[i].path, i);
+	    dirs[i].dirty = 0;
+	}
+    stat_all();
+    for (i = 0; i < nentries; i++)
+    {
+	e = &entries[i];
+	if (e->ok && isexecutable(e->mode, e->uid, e->gid))
+	    add(names + e->name, &dirs[dirowners[e->dir]]);
+    }
+    for (i = 0; i < ndirfds; i++)
+    {
+	close(dirfds[i]);
+	qsort(dirs[dirowners[i]].progs, dirs[dirowners[i]].nprogs, sizeof(char*), compare);
+    }
+}
+
+static int heap_less(struct dir* dirs, size_t* pos, size_t a, size_t b)
+{
+    return strcmp(dirs[a].progs[pos[a]], dirs[b].progs[pos[b]]) < 0;
+}
+
+static void sift_down(struct dir* dirs, size_t* pos, size_t* heap, size_t n, size_t i)
+{
+    size_t child, tmp;
+
+    while ((child = 2 * i + 1) < n)
+    {
+	if (child + 1 < n && heap_less(dirs, pos, heap[child + 1], heap[child]))
+	    child++;
+	if (!heap_less(dirs, pos, heap[child], heap[i]))
+	    break;
+	tmp = heap[i];
+	heap[i] = heap[child];
+	heap[child] = tmp;
+	i = child;
+    }
+}
+
+/* all programs, sorted and without duplicates, merged from the sorted lists
+ * of the directories; the strings stay the dirs' */
+static char** collect(struct dir* dirs, size_t ndirs)
+{
+    char** progs;
+    size_t* heap;
+    size_t* pos;
+    size_t i, d, n = 0, nheap = 0;
+
+    for (i = 0; i < ndirs; i++)
+	n += dirs[i].nprogs;
+    progs = (char**)malloc(sizeof(char*) * (n + 1));
+    heap = (size_t*)malloc(sizeof(size_t) * (ndirs + 1));
+    pos = (size_t*)calloc(ndirs + 1, sizeof(size_t));
+    if (progs == NULL || heap == NULL || pos == NULL)
+	die("malloc");
+    for (i = 0; i < ndirs; i++)
+	if (dirs[i].nprogs > 0)
+	    heap[nheap++] = i;
+    for (i = nheap; i-- > 0; )
+	sift_down(dirs, pos, heap, nheap, i);
+
+    n = 0;
+    while (nheap > 0)
+    {
+	d = heap[0];
+	if (n == 0 || strcmp(progs[n - 1], dirs[d].progs[pos[d]]) != 0)
+	    progs[n++] = dirs[d].progs[pos[d]];
+	if (++pos[d] == dirs[d].nprogs)
+	    heap[0] = heap[--nheap];
+	sift_down(dirs, pos, heap, nheap, 0);
+    }
+    progs[n] = NULL;
+    free(heap);
+    free(pos);
+    return progs;
+}
+
+/* take the lists of directories which have not changed since they were
+ * indexed, and mark the others dirty; returns how many are dirty, plus how
+ * many indexed directories have left PATH, so 0 means the cache is good */
+static size_t load_index(struct dir* dirs, size_t ndirs)
+{
+    char buf[PATH_MAX + 128];
+    unsigned long long dev, ino;
+    long long sec, nsec;
+    unsigned long count;
+    struct dir* d;
+    char* p;
+    size_t i, dirty = ndirs;
+    FILE* in;
+    int n;
+
+    for (i = 0; i < ndirs; i++)
+    {
+	stat_dir(&dirs[i]);
+	dirs[i].dirty = 1;
+    }
+    in = fopen(index_path, "r");
+    if (in == NULL)
+	return dirty;
+    if (fgets(buf, sizeof(buf), in) == NULL || strcmp(buf, INDEX_VERSION "\n") != 0)
+    {
+	fclose(in);
+	return dirty;
+    }
+
+    while (fgets(buf, sizeof(buf), in) != NULL)
+    {
+	if ((p = strchr(buf, '\n')) != NULL)
+	    *p = '\0';
+	if (sscanf(buf, "%llu %llu %lld %lld %lu %n", &dev, &ino, &sec, &nsec, &count, &n) < 5)
+	    break;
+	for (d = NULL, i = 0; i < ndirs; i++)
+	    if (dirs[i].dirty && strcmp(dirs[i].path, buf + n) == 0)
+		d = &dirs[i];
+	if (d == NULL)
+	    dirty++;
+	else if (d->dev != dev || d->ino != ino || d->sec != sec || d->nsec != nsec)
+	    d = NULL;
+	for (; count > 0 && fgets(buf, sizeof(buf), in) != NULL; count--)
+	{
+	    if ((p = strchr(buf, '\n')) != NULL)
+		*p = '\0';
+	    if (d != NULL)
+		add(buf, d);
+	}
+	if (count > 0) /* cut short */
+	{
+	    if (d != NULL)
+		while (d->nprogs > 0)
+		    free(d->progs[--d->nprogs]);
+	    break;
+	}
+	if (d != NULL)
+	{
+	    d->dirty = 0;
+	    dirty--;
+	}
+    }
+    fclose(in);
+    return dirty;
+}
+
+struct slot
+{
+    char name[17];
+    long long used;
+};
+
+static int compare_slots(const void* a, const void* b)
+{
+    const struct slot* x = (const struct slot*)a;
+    const struct slot* y = (const struct slot*)b;
+    return x->used < y->used ? 1 : x->used > y->used ? -1 : 0;
+}
+
+/* remove all but the keep most recently used slots */
+static void prune_slots(size_t keep)
+{
+    static const char* suffixes[] = { "", ".dirs", ".bin" };
+    char path[PATH_MAX];
+    struct slot* slots = NULL;
+    size_t nslots = 0, allocated = 0, i, j;
+    struct dirent* ent;
+    struct stat st;
+    DIR* dir;
+
+    dir = opendir(slot_dir);
+    if (dir == NULL)
+	return;
+    while ((ent = readdir(dir)) != NULL)
+    {
+	if (strlen(ent->d_name) != 16 + strlen(".dirs") || strcmp(ent->d_name + 16, ".dirs") != 0
+		|| fstatat(dirfd(dir), ent->d_name, &st, 0) != 0)
+	    continue;
+	if (nslots == allocated)
+	{
+	    allocated = allocated ? 2 * allocated : 16;
+	    slots = (struct slot*)realloc(slots, allocated * sizeof(struct slot));
+	    if (slots == NULL)
+		die("realloc");
+	}
+	memcpy(slots[nslots].name, ent->d_name, 16);
+	slots[nslots].name[16] = '\0';
+	slots[nslots].used = st.st_mtime;
+	nslots++;
+    }
+    closedir(dir);
+
+    if (nslots > keep)
+    {
+	qsort(slots, nslots, sizeof(struct slot), compare_slots);
+	for (i = keep; i < nslots; i++)
+	    for (j = 0; j < sizeof(suffixes) / sizeof(suffixes[0]); j++)
+	    {
+		snprintf(path, sizeof(path), "%s/%s%s", slot_dir, slots[i].name, suffixes[j]);
+		unlink(path);
+	    }
+    }
+    free(slots);
+}
+
+/* a temporary file next to path, to be renamed over it by commit_file() */
+static FILE* create_file(const char* path, char** tmp)
+{
+    FILE* out;
+    int fd;
+
+    *tmp = (char*)malloc(strlen(path) + strlen(".XXXXXX") + 1);
+    if (*tmp == NULL)
+	die("malloc");
+    strcpy(*tmp, path);
+    strcat(*tmp, ".XXXXXX");
+    fd = mkstemp(*tmp);
+    if (fd < 0 || (out = fdopen(fd, "w")) == NULL)
+	die("mkstemp");
+    return out;
+}
+
+/* replace path as a whole, so that readers never see half of it */
+static void commit_file(FILE* out, char* tmp, const char* path)
+{
+    if (fclose(out) == EOF || rename(tmp, path) != 0)
+    {
+	perror("write cache");
+	unlink(tmp);
+    }
+    free(tmp);
+}
+
+static unsigned char fold(unsigned char c)
+{
+    return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+}
+
+/* the binary cache: every name is followed by its folded form, unless that
+ * is the same, and the items are written before the strings they refer to */
+static void write_bincache(char** progs)
+{
+    BinHeader header;
+    BinItem* items;
+    unsigned long long size = 0;
+    size_t i, n = count_charpp(progs);
+    const char* p;
+    char* tmp;
+    FILE* out;
+    int folds;
+
+    items = (BinItem*)malloc(sizeof(BinItem) * (n ? n : 1));
+    if (items == NULL)
+	die("malloc");
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BINMAGIC, sizeof(header.magic));
+    header.version = BINVERSION;
+    header.nitems = n;
+    for (i = 0; i < n; i++)
+    {
+	items[i].text = size;
+	for (folds = 0, p = progs[i]; *p != '\0'; p++)
+	    folds |= fold(*p) != (unsigned char)*p;
+	items[i].len = p - progs[i];
+	size += items[i].len + 1;
+	items[i].fold = folds ? size : items[i].text;
+	if (folds)
+	    size += items[i].len + 1;
+	if (items[i].len > items[header.longest].len)
+	    header.longest = i;
+    }
+    if (size > UINT32_MAX)
+    {
+	fputs("dmenu_path: too many programs for the binary cache\n", stderr);
+	free(items);
+	return;
+    }
+    header.strsize = size;
+
+    out = create_file(bin_path, &tmp);
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(items, sizeof(BinItem), n, out);
+    for (i = 0; i < n; i++)
+    {
+	fwrite(progs[i], 1, items[i].len + 1, out);
+	if (items[i].fold != items[i].text)
+	{
+	    for (p = progs[i]; *p != '\0'; p++)
+		fputc(fold(*p), out);
+	    fputc('\0', out);
+	}
+    }
+    commit_file(out, tmp, bin_path);
+    free(items);
+}
+
+static void write_cache(struct dir* dirs, size_t ndirs, char** progs)
+{
+    char* tmp;
+    FILE* out;
+    size_t i, j;
+
+    out = create_file(index_path, &tmp);
+    fputs(INDEX_VERSION "\n", out);
+    for (i = 0; i < ndirs; i++)
+    {
+	fprintf(out, "%llu %llu %lld %lld %lu %s\n", dirs[i].dev, dirs[i].ino,
+		dirs[i].sec, dirs[i].nsec, (unsigned long)dirs[i].nprogs, dirs[i].path);
+	for (j = 0; j < dirs[i].nprogs; j++)
+	    fprintf(out, "%s\n", dirs[i].progs[j]);
+    }
+    commit_file(out, tmp, index_path);
+
+    out = create_file(cache_path, &tmp);
+    path_print(progs, out);
+    commit_file(out, tmp, cache_path);
+
+    write_bincache(progs);
+}
+
+/* rescan what is dirty and write the caches; returns the programs, which
+ * belong to the dirs */
+char** path_update(void)
+{
+    char** progs;
+
+    scan(dirs, ndirs);
+    progs = collect(dirs, ndirs);
+    write_cache(dirs, ndirs, progs);
+    stale = 0;
+    return progs;
+}
+
+/* drop the parent watch of dir, unless another dir still uses it */
+static void unwatch_parent(int fd, struct dir* dir)
+{
+    size_t i;
+    int wd;
+
+    wd = dir->pwd;
+    dir->pwd = -1;
+    for (i = 0; i < ndirs; i++)
+	if (dirs[i].wd == wd || dirs[i].pwd == wd)
+	    return;
+    inotify_rm_watch(fd, wd);
+}
+
+/* watch a missing directory again if it is back, and return 1.  Otherwise
+ * watch its nearest existing parent for it to be created or moved in; that
+ * parent moves down as the directories in between appear.  Parent watches
+ * are added with IN_MASK_ADD, as they may be shared with each other and with
+ * the watch of another PATH directory. */
+static int watch_missing(int fd, struct dir* dir)
+{
+    char* path;
+    char* slash;
+    int old, wd;
+
+    if ((dir->wd = inotify_add_watch(fd, dir->path, WATCH_EVENTS)) >= 0)
+    {
+	if (dir->pwd >= 0)
+	    unwatch_parent(fd, dir);
+	dir->dirty = 1;
+	return 1;
+    }
+    path = strdup(dir->path);
+    if (path == NULL)
+	die("strdup");
+    for (wd = -1; wd < 0 && (slash = strrchr(path, '/')) != NULL;)
+    {
+	slash[slash == path] = '\0';	/* keep the root */
+	wd = inotify_add_watch(fd, path, PARENT_EVENTS);
+	if (slash == path)
+	    break;
+    }
+    free(path);
+    old = dir->pwd;
+    if (old >= 0 && old != wd)
+	unwatch_parent(fd, dir);
+    dir->pwd = wd;
+    return 0;
+}
+
+/* -d: keep the cache fresh by watching PATH */
+void path_watch(void)
+{
+    long buf[4096];
+    struct inotify_event* ev;
+    struct pollfd pfd;
+    struct dir old;
+    ssize_t n, pos;
+    size_t i;
+    int changed, update;
+
+    pfd.fd = inotify_init1(IN_CLOEXEC);
+    pfd.events = POLLIN;
+    if (pfd.fd < 0)
+	die("inotify_init1");
+    for (i = 0; i < ndirs; i++)
+    {
+	dirs[i].wd = inotify_add_watch(pfd.fd, dirs[i].path, WATCH_EVENTS);
+	dirs[i].pwd = -1;
+	/* the index may be stale already if something changed meanwhile */
+	old = dirs[i];
+	stat_dir(&dirs[i]);
+	if (old.dev != dirs[i].dev || old.ino != dirs[i].ino
+		|| old.sec != dirs[i].sec || old.nsec != dirs[i].nsec)
+	    dirs[i].dirty = 1;
+    }
+
+    for (changed = update = 1;;)
+    {
+	if (changed)
+	{
+	    /* directories which were missing may be back */
+	    for (i = 0; i < ndirs; i++)
+		if (dirs[i].wd < 0 && watch_missing(pfd.fd, &dirs[i]))
+		    update = 1;
+	    /* events on a parent alone change no listing */
+	    if (update)
+		free(path_update());
+	    changed = update = 0;
+	}
+	/* wait for a change, then for things to settle down */
+	for (;;)
+	{
+	    if (poll(&pfd, 1, changed ? SETTLE_MS : -1) < 0)
+	    {
+		if (errno == EINTR)
+		    continue;
+		die("poll");
+	    }
+	    if (!(pfd.revents & POLLIN))
+		break;
+	    if ((n = read(pfd.fd, buf, sizeof(buf))) < 0)
+	    {
+		if (errno == EINTR)
+		    continue;
+		die("read");
+	    }
+	    for (pos = 0; pos < n; pos += sizeof(struct inotify_event) + ev->len)
+	    {
+		ev = (struct inotify_event*)((char*)buf + pos);
+		for (i = 0; i < ndirs; i++)
+		{
+		    if (dirs[i].wd == ev->wd || (ev->mask & IN_Q_OVERFLOW))
+		    {
+			dirs[i].dirty = 1;
+			/* the directory is gone or moved away, and a watch would
+			 * follow it there; watch_missing() watches the path again */
+			if (dirs[i].wd == ev->wd && (ev->mask & (IN_MOVE_SELF | IN_DELETE_SELF)))
+			{
+			    inotify_rm_watch(pfd.fd, dirs[i].wd);
+			    dirs[i].wd = -1;
+			}
+			else if (ev->mask & IN_IGNORED)
+			    dirs[i].wd = -1;
+			update = 1;
+		    }
+		    /* the parent is gone or moved, look further up */
+		    if (dirs[i].pwd == ev->wd && (ev->mask & (IN_IGNORED | IN_MOVE_SELF)))
+			unwatch_parent(pfd.fd, &dirs[i]);
+		}
+		changed = 1;
+	    }
+	}
+    }
+}
+
+void path_open(void)
+{
+    char* PATH;
+    size_t i;
+
+    PATH = get_PATH();
+    uid = getuid();
+    gid = getgid();
+    ngroups = getgroups(0, NULL);
+    groups = (gid_t*)malloc(sizeof(gid_t) * (ngroups > 0 ? ngroups : 1));
+    if (groups == NULL)
+	die("malloc");
+    ngroups = getgroups(ngroups, groups);
+    if (ngroups < 0)
+	ngroups = 0;
+
+    split_PATH(PATH, &paths);
+    free(PATH);
+    sort(&paths);
+    uniq(&paths);
+    slot_dir = get_slot_dir();
+    cache_path = get_cache_path(paths);
+
+    ndirs = count_charpp(paths);
+    dirs = (struct dir*)calloc(ndirs ? ndirs : 1, sizeof(struct dir));
+    if (dirs == NULL)
+	die("calloc");
+    for (i = 0; i < ndirs; i++)
+    {
+	dirs[i].path = paths[i];
+	dirs[i].wd = -1;
+    }
+
+    index_path = get_cache_sibling(".dirs");
+    bin_path = get_cache_sibling(".bin");
+    /* the index is touched on every use, which is what prune_slots goes by */
+    if (utimensat(AT_FDCWD, index_path, NULL, 0) != 0)
+	prune_slots(MAX_SLOTS - 1);
+    stale = load_index(dirs, ndirs);
+}
+
+void path_close(void)
+{
+    size_t i;
+
+    for (i = 0; i < ndirs; i++)
+    {
+	while (dirs[i].nprogs > 0)
+	    free(dirs[i].progs[--dirs[i].nprogs]);
+	free(dirs[i].progs);
+    }
+    free(dirs);
+    free(dirfds);
+    free(dirowners);
+    free(entries);
+    free(names);
+    free_charpp(paths);
+    free(cache_path);
+    free(slot_dir);
+    free(index_path);
+    free(bin_path);
+    free(groups);
+    /* ready for the next path_open */
+    dirs = NULL;
+    dirfds = NULL;
+    dirowners = NULL;
+    entries = NULL;
+    names = NULL;
+    ndirs = ndirfds = nentries = entries_allocated = names_used = names_allocated = 0;
+}
+
+const char* path_list_file(void)
+{
+    return cache_path;
+}
+
+const char* path_bin_file(void)
+{
+    return bin_path;
+}
+
+int path_stale(const char* file)
+{
+    return stale > 0 || access(file, R_OK) != 0;
+}
+
+void path_invalidate(void)
+{
+    size_t i;
+
+    for (i = 0; i < ndirs; i++)
+	dirs[i].dirty = 1;
+    stale = ndirs;
+}
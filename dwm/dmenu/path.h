@@ -0,0 +1,13 @@
+/* See LICENSE file for copyright and license details. */
+
+/* The executables in $PATH and their caches, see path.c.  path_open() reads
+ * $PATH and the index of its cache slot, and must come first. */
+void path_open(void);
+void path_close(void);
+const char* path_list_file(void);
+const char* path_bin_file(void);
+int path_stale(const char* file);
+void path_invalidate(void);
+char** path_update(void);
+void path_print(char** progs, FILE* out);
+void path_watch(void);
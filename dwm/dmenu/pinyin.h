@@ -0,0 +1,805 @@
+/* See LICENSE file for copyright and license details. */
+/* pinyin of the 3755 level-1 hanzi of GB2312, which that standard orders by
+ * pronunciation; polyphonic characters carry their first reading only. */
+
+static const char *pysyls[] = {
+	"a", "ai", "an", "ang", "ao", "ba", "bai", "ban", "bang", "bao", "bei",
+	"ben", "beng", "bi", "bian", "biao", "bie", "bin", "bing", "bo", "bu",
+	"ca", "cai", "can", "cang", "cao", "ce", "ceng", "cha", "chai", "chan",
+	"chang", "chao", "che", "chen", "cheng", "chi", "chong", "chou", "chu",
+	"chuai", "chuan", "chuang", "chui", "chun", "chuo", "ci", "cong",
+	"cou", "cu", "cuan", "cui", "cun", "cuo", "da", "dai", "dan", "dang",
+	"dao", "de", "deng", "di", "dian", "diao", "die", "ding", "diu",
+	"dong", "dou", "du", "duan", "dui", "dun", "duo", "e", "en", "er",
+	"fa", "fan", "fang", "fei", "fen", "feng", "fo", "fou", "fu", "ga",
+	"gai", "gan", "gang", "gao", "ge", "gei", "gen", "geng", "gong", "gou",
+	"gu", "gua", "guai", "guan", "guang", "gui", "gun", "guo", "ha", "hai",
+	"han", "hang", "hao", "he", "hei", "hen", "heng", "hong", "hou", "hu",
+	"hua", "huai", "huan", "huang", "hui", "hun", "huo", "ji", "jia",
+	"jian", "jiang", "jiao", "jie", "jin", "jing", "jiong", "jiu", "ju",
+	"juan", "jue", "jun", "ka", "kai", "kan", "kang", "kao", "ke", "ken",
+	"keng", "kong", "kou", "ku", "kua", "kuai", "kuan", "kuang", "kui",
+	"kun", "kuo", "la", "lai", "lan", "lang", "lao", "le", "lei", "leng",
+	"li", "lia", "lian", "liang", "liao", "lie", "lin", "ling", "liu",
+	"long", "lou", "lu", "lv", "luan", "lue", "lun", "luo", "ma", "mai",
+	"man", "mang", "mao", "me", "mei", "men", "meng", "mi", "mian", "miao",
+	"mie", "min", "ming", "miu", "mo", "mou", "mu", "na", "nai", "nan",
+	"nang", "nao", "ne", "nei", "nen", "neng", "ni", "nian", "niang",
+	"niao", "nie", "nin", "ning", "niu", "nong", "nu", "nv", "nuan", "nue",
+	"nuo", "o", "ou", "pa", "pai", "pan", "pang", "pao", "pei", "pen",
+	"peng", "pi", "pian", "piao", "pie", "pin", "ping", "po", "pu", "qi",
+	"qia", "qian", "qiang", "qiao", "qie", "qin", "qing", "qiong", "qiu",
+	"qu", "quan", "que", "qun", "ran", "rang", "rao", "re", "ren", "reng",
+	"ri", "rong", "rou", "ru", "ruan", "rui", "run", "ruo", "sa", "sai",
+	"san", "sang", "sao", "se", "sen", "seng", "sha", "shai", "shan",
+	"shang", "shao", "she", "shen", "sheng", "shi", "shou", "shu", "shua",
+	"shuai", "shuan", "shuang", "shui", "shun", "shuo", "si", "song",
+	"sou", "su", "suan", "sui", "sun", "suo", "ta", "tai", "tan", "tang",
+	"tao", "te", "teng", "ti", "tian", "tiao", "tie", "ting", "tong",
+	"tou", "tu", "tuan", "tui", "tun", "tuo", "wa", "wai", "wan", "wang",
+	"wei", "wen", "weng", "wo", "wu", "xi", "xia", "xian", "xiang", "xiao",
+	"xie", "xin", "xing", "xiong", "xiu", "xu", "xuan", "xue", "xun", "ya",
+	"yan", "yang", "yao", "ye", "yi", "yin", "ying", "yo", "yong", "you",
+	"yu", "yuan", "yue", "yun", "za", "zai", "zan", "zang", "zao", "ze",
+	"zei", "zen", "zeng", "zha", "zhai", "zhan", "zhang", "zhao", "zhe",
+	"zhen", "zheng", "zhi", "zhong", "zhou", "zhu", "zhua", "zhuai",
+	"zhuan", "zhuang", "zhui", "zhun", "zhuo", "zi", "zong", "zou", "zu",
+	"zuan", "zui", "zun", "zuo",
+};
+
+/* sorted by code point, for binary search */
+static const struct {
+	unsigned short cp, syl;
+} pytab[] = {
+	{0x4e00,350},{0x4e01,65},{0x4e03,241},{0x4e07,324},{0x4e08,372},
+	{0x4e09,271},{0x4e0a,280},{0x4e0b,332},{0x4e0d,20},{0x4e0e,356},
+	{0x4e11,38},{0x4e13,383},{0x4e14,246},{0x4e16,285},{0x4e18,250},
+	{0x4e19,18},{0x4e1a,349},{0x4e1b,47},{0x4e1c,67},{0x4e1d,295},
+	{0x4e22,66},{0x4e24,167},{0x4e25,346},{0x4e27,272},{0x4e2a,91},
+	{0x4e2b,345},{0x4e2d,378},{0x4e30,82},{0x4e32,41},{0x4e34,170},
+	{0x4e38,324},{0x4e39,56},{0x4e3a,326},{0x4e3b,380},{0x4e3d,164},
+	{0x4e3e,134},{0x4e43,201},{0x4e45,133},{0x4e48,186},{0x4e49,350},
+	{0x4e4b,377},{0x4e4c,330},{0x4e4d,369},{0x4e4e,116},{0x4e4f,77},
+	{0x4e50,161},{0x4e52,238},{0x4e53,228},{0x4e54,245},{0x4e56,99},
+	{0x4e58,35},{0x4e59,350},{0x4e5d,133},{0x4e5e,241},{0x4e5f,349},
+	{0x4e60,331},{0x4e61,334},{0x4e66,287},{0x4e70,182},{0x4e71,177},
+	{0x4e73,264},{0x4e7e,243},{0x4e86,168},{0x4e88,356},{0x4e89,376},
+	{0x4e8b,285},{0x4e8c,76},{0x4e8e,356},{0x4e8f,153},{0x4e91,359},
+	{0x4e92,116},{0x4e94,330},{0x4e95,131},{0x4e9a,345},{0x4e9b,336},
+	{0x4ea1,325},{0x4ea2,141},{0x4ea4,128},{0x4ea5,106},{0x4ea6,350},
+	{0x4ea7,30},{0x4ea8,113},{0x4ea9,199},{0x4eab,334},{0x4eac,131},
+	{0x4ead,314},{0x4eae,167},{0x4eb2,247},{0x4eba,259},{0x4ebf,350},
+	{0x4ec0,285},{0x4ec1,259},{0x4ec5,130},{0x4ec6,240},{0x4ec7,38},
+	{0x4eca,130},{0x4ecb,129},{0x4ecd,260},{0x4ece,47},{0x4ed1,179},
+	{0x4ed3,24},{0x4ed4,388},{0x4ed5,285},{0x4ed6,303},{0x4ed7,372},
+	{0x4ed8,85},{0x4ed9,333},{0x4edf,243},{0x4ee3,55},{0x4ee4,171},
+	{0x4ee5,350},{0x4eea,350},{0x4eec,188},{0x4ef0,347},{0x4ef2,378},
+	{0x4ef6,126},{0x4ef7,125},{0x4efb,259},{0x4efd,81},{0x4eff,79},
+	{0x4f01,241},{0x4f0a,350},{0x4f0d,330},{0x4f0e,124},{0x4f0f,85},
+	{0x4f10,77},{0x4f11,340},{0x4f17,378},{0x4f18,355},{0x4f19,123},
+	{0x4f1a,121},{0x4f1e,271},{0x4f1f,326},{0x4f20,41},{0x4f24,280},
+	{0x4f26,179},{0x4f2a,326},{0x4f2f,19},{0x4f30,97},{0x4f34,7},
+	{0x4f36,171},{0x4f38,283},{0x4f3a,295},{0x4f3c,295},{0x4f43,62},
+	{0x4f46,56},{0x4f4d,326},{0x4f4e,61},{0x4f4f,380},{0x4f50,395},
+	{0x4f51,355},{0x4f53,310},{0x4f55,110},{0x4f59,356},{0x4f5b,83},
+	{0x4f5c,395},{0x4f60,209},{0x4f63,354},{0x4f69,230},{0x4f6c,160},
+	{0x4f6f,347},{0x4f70,6},{0x4f73,125},{0x4f7f,285},{0x4f84,377},
+	{0x4f88,36},{0x4f8b,164},{0x4f8d,285},{0x4f97,67},{0x4f9b,95},
+	{0x4f9d,350},{0x4fa0,332},{0x4fa3,176},{0x4fa5,128},{0x4fa6,375},
+	{0x4fa7,26},{0x4fa8,245},{0x4fa9,150},{0x4fae,330},{0x4faf,115},
+	{0x4fb5,247},{0x4fbf,14},{0x4fc3,49},{0x4fc4,74},{0x4fca,137},
+	{0x4fcf,245},{0x4fd0,164},{0x4fd7,298},{0x4fd8,85},{0x4fdd,9},
+	{0x4fde,356},{0x4fe1,337},{0x4fe9,165},{0x4fed,126},{0x4fee,340},
+	{0x4fef,85},{0x4ff1,134},{0x4ffa,2},{0x500d,10},{0x5012,58},
+	{0x5014,136},{0x5018,306},{0x5019,115},{0x501a,350},{0x501f,129},
+	{0x5021,31},{0x5026,135},{0x502a,209},{0x503a,370},{0x503c,377},
+	{0x503e,248},{0x5047,125},{0x504f,234},{0x505a,395},{0x505c,314},
+	{0x5065,126},{0x5076,224},{0x5077,316},{0x507f,31},{0x5080,153},
+	{0x5085,85},{0x5088,164},{0x508d,8},{0x50a3,55},{0x50a8,39},
+	{0x50ac,51},{0x50b2,4},{0x50bb,277},{0x50cf,334},{0x50da,168},
+	{0x50e7,276},{0x50f3,298},{0x50f5,127},{0x50fb,233},{0x5112,264},
+	{0x5121,162},{0x513f,76},{0x5141,359},{0x5143,357},{0x5144,339},
+	{0x5145,37},{0x5146,373},{0x5148,333},{0x5149,101},{0x514b,143},
+	{0x514d,191},{0x5151,71},{0x5154,317},{0x515a,57},{0x515c,68},
+	{0x5162,131},{0x5165,264},{0x5168,252},{0x516b,5},{0x516c,95},
+	{0x516d,172},{0x5170,158},{0x5171,95},{0x5173,100},{0x5174,338},
+	{0x5175,18},{0x5176,241},{0x5177,134},{0x5178,62},{0x5179,388},
+	{0x517b,347},{0x517c,126},{0x517d,286},{0x5180,124},{0x5185,206},
+	{0x5188,89},{0x5189,255},{0x518c,26},{0x518d,361},{0x5192,185},
+	{0x5195,191},{0x5197,262},{0x5199,336},{0x519b,137},{0x519c,217},
+	{0x51a0,100},{0x51a4,357},{0x51ac,67},{0x51af,82},{0x51b0,18},
+	{0x51b2,37},{0x51b3,136},{0x51b5,152},{0x51b6,349},{0x51b7,163},
+	{0x51bb,67},{0x51c0,131},{0x51c4,241},{0x51c6,386},{0x51c9,167},
+	{0x51cb,63},{0x51cc,171},{0x51cf,126},{0x51d1,48},{0x51db,170},
+	{0x51dd,215},{0x51e0,124},{0x51e1,78},{0x51e4,82},{0x51ed,238},
+	{0x51ef,139},{0x51f0,120},{0x51f3,60},{0x51f6,339},{0x51f8,317},
+	{0x51f9,4},{0x51fa,39},{0x51fb,124},{0x51fd,107},{0x51ff,364},
+	{0x5200,58},{0x5201,63},{0x5203,259},{0x5206,81},{0x5207,246},
+	{0x520a,140},{0x5211,338},{0x5212,117},{0x5217,169},{0x5218,172},
+	{0x5219,365},{0x521a,89},{0x521b,42},{0x521d,39},{0x5220,279},
+	{0x5224,227},{0x5228,229},{0x5229,164},{0x522b,16},{0x522e,98},
+	{0x5230,58},{0x5236,377},{0x5237,288},{0x5238,252},{0x5239,277},
+	{0x523a,46},{0x523b,143},{0x523d,102},{0x5241,73},{0x5242,124},
+	{0x5243,310},{0x524a,335},{0x524d,243},{0x5250,98},{0x5251,126},
+	{0x5254,310},{0x5256,239},{0x5265,9},{0x5267,134},{0x5269,284},
+	{0x526a,126},{0x526f,85},{0x5272,91},{0x527f,128},{0x5288,233},
+	{0x529b,164},{0x529d,252},{0x529e,7},{0x529f,95},{0x52a0,125},
+	{0x52a1,330},{0x52a3,169},{0x52a8,67},{0x52a9,380},{0x52aa,218},
+	{0x52ab,129},{0x52b1,164},{0x52b2,130},{0x52b3,160},{0x52bf,285},
+	{0x52c3,19},{0x52c7,354},{0x52c9,191},{0x52cb,344},{0x52d2,161},
+	{0x52d8,140},{0x52df,199},{0x52e4,247},{0x52fa,281},{0x52fe,96},
+	{0x52ff,330},{0x5300,359},{0x5305,9},{0x5306,47},{0x5308,339},
+	{0x5316,117},{0x5317,10},{0x5319,36},{0x531d,360},{0x5320,127},
+	{0x5321,152},{0x5323,332},{0x532a,80},{0x5339,233},{0x533a,251},
+	{0x533b,350},{0x533f,209},{0x5341,285},{0x5343,243},{0x5347,284},
+	{0x5348,330},{0x5349,121},{0x534a,7},{0x534e,117},{0x534f,336},
+	{0x5351,10},{0x5352,391},{0x5353,387},{0x5355,56},{0x5356,182},
+	{0x5357,202},{0x535a,19},{0x535c,19},{0x535e,14},{0x5360,371},
+	{0x5361,138},{0x5362,175},{0x5364,175},{0x5367,329},{0x536b,326},
+	{0x536f,185},{0x5370,351},{0x5371,326},{0x5373,124},{0x5374,253},
+	{0x5375,177},{0x5377,135},{0x5378,336},{0x537f,248},{0x5382,31},
+	{0x5384,74},{0x5385,314},{0x5386,164},{0x5389,164},{0x538b,345},
+	{0x538c,346},{0x5395,26},{0x5398,164},{0x539a,115},{0x539f,357},
+	{0x53a2,334},{0x53a6,332},{0x53a8,39},{0x53a9,133},{0x53bb,251},
+	{0x53bf,333},{0x53c1,271},{0x53c2,23},{0x53c8,355},{0x53c9,28},
+	{0x53ca,124},{0x53cb,355},{0x53cc,291},{0x53cd,78},{0x53d1,77},
+	{0x53d4,287},{0x53d6,251},{0x53d7,286},{0x53d8,14},{0x53d9,341},
+	{0x53db,227},{0x53e0,64},{0x53e3,147},{0x53e4,97},{0x53e5,134},
+	{0x53e6,171},{0x53ea,377},{0x53eb,128},{0x53ec,373},{0x53ed,5},
+	{0x53ee,65},{0x53ef,143},{0x53f0,304},{0x53f2,285},{0x53f3,355},
+	{0x53f6,349},{0x53f7,109},{0x53f8,295},{0x53f9,305},{0x53fc,63},
+	{0x5401,356},{0x5403,36},{0x5404,91},{0x5408,110},{0x5409,124},
+	{0x540a,63},{0x540c,315},{0x540d,195},{0x540e,115},{0x540f,164},
+	{0x5410,317},{0x5411,334},{0x5413,332},{0x5415,176},{0x5417,181},
+	{0x541b,137},{0x541d,170},{0x541e,320},{0x541f,351},{0x5420,80},
+	{0x5426,84},{0x5427,5},{0x5428,72},{0x5429,81},{0x542b,107},
+	{0x542c,314},{0x542d,145},{0x542e,293},{0x542f,241},{0x5431,377},
+	{0x5434,330},{0x5435,32},{0x5438,331},{0x5439,43},{0x543b,327},
+	{0x543c,115},{0x543e,330},{0x5440,345},{0x5446,55},{0x5448,35},
+	{0x544a,90},{0x5450,200},{0x5455,224},{0x5458,357},{0x545b,244},
+	{0x545c,330},{0x5462,205},{0x5468,379},{0x5473,326},{0x5475,110},
+	{0x5478,230},{0x547b,283},{0x547c,116},{0x547d,195},{0x5480,134},
+	{0x5486,229},{0x548b,369},{0x548c,110},{0x548e,133},{0x548f,354},
+	{0x5490,85},{0x5492,379},{0x5495,97},{0x5496,138},{0x5499,173},
+	{0x54a8,388},{0x54ac,348},{0x54af,138},{0x54b1,362},{0x54b3,143},
+	{0x54b8,333},{0x54bd,346},{0x54c0,1},{0x54c1,237},{0x54c4,114},
+	{0x54c6,73},{0x54c7,322},{0x54c8,105},{0x54c9,361},{0x54cd,334},
+	{0x54ce,1},{0x54d1,345},{0x54d7,117},{0x54df,353},{0x54e5,91},
+	{0x54e6,223},{0x54e8,281},{0x54e9,164},{0x54ea,200},{0x54ed,148},
+	{0x54ee,335},{0x54f2,374},{0x54fa,20},{0x54fc,113},{0x5501,346},
+	{0x5506,302},{0x5507,44},{0x5509,1},{0x5510,306},{0x5524,119},
+	{0x552c,116},{0x552e,286},{0x552f,326},{0x5531,31},{0x553e,321},
+	{0x5543,144},{0x5544,387},{0x5546,280},{0x554a,0},{0x5561,80},
+	{0x5564,233},{0x5565,277},{0x5566,156},{0x556a,225},{0x556e,213},
+	{0x5578,335},{0x557c,310},{0x5580,138},{0x5582,326},{0x5584,279},
+	{0x5587,156},{0x5589,115},{0x558a,107},{0x5598,41},{0x559c,331},
+	{0x559d,110},{0x55a7,342},{0x55b3,369},{0x55b7,231},{0x55bb,356},
+	{0x55c5,340},{0x55d3,272},{0x55dc,285},{0x55e1,328},{0x55e3,295},
+	{0x55fd,298},{0x5609,125},{0x560e,86},{0x5618,341},{0x561b,181},
+	{0x5631,380},{0x5632,32},{0x5634,393},{0x5636,295},{0x563b,331},
+	{0x563f,111},{0x564e,349},{0x5668,241},{0x566a,364},{0x566c,285},
+	{0x5676,86},{0x568e,109},{0x568f,310},{0x56a3,335},{0x56b7,256},
+	{0x56bc,128},{0x56ca,203},{0x56da,250},{0x56db,295},{0x56de,121},
+	{0x56e0,351},{0x56e2,318},{0x56e4,72},{0x56ed,357},{0x56f0,154},
+	{0x56f1,47},{0x56f4,326},{0x56fa,97},{0x56fd,104},{0x56fe,317},
+	{0x5703,240},{0x5706,357},{0x5708,252},{0x571f,317},{0x5723,284},
+	{0x5728,361},{0x572d,102},{0x5730,61},{0x573a,31},{0x573e,124},
+	{0x5740,377},{0x5747,137},{0x574a,79},{0x574d,305},{0x574e,140},
+	{0x574f,118},{0x5750,395},{0x5751,145},{0x5757,150},{0x575a,126},
+	{0x575b,305},{0x575d,5},{0x575e,330},{0x575f,81},{0x5760,385},
+	{0x5761,239},{0x5764,154},{0x5766,305},{0x576a,238},{0x576f,233},
+	{0x5777,143},{0x5782,43},{0x5783,156},{0x5784,173},{0x578b,338},
+	{0x5792,162},{0x579b,73},{0x57a2,96},{0x57a3,357},{0x57a6,144},
+	{0x57ab,62},{0x57ae,149},{0x57c2,94},{0x57c3,1},{0x57cb,182},
+	{0x57ce,35},{0x57d4,240},{0x57df,356},{0x57e0,20},{0x57f9,230},
+	{0x57fa,124},{0x5802,306},{0x5806,71},{0x5811,243},{0x5815,73},
+	{0x5821,9},{0x5824,61},{0x582a,140},{0x5830,346},{0x5835,69},
+	{0x584c,303},{0x5851,298},{0x5854,303},{0x5858,306},{0x585e,270},
+	{0x586b,311},{0x5883,131},{0x5885,287},{0x5892,280},{0x5893,199},
+	{0x5899,244},{0x589e,368},{0x589f,341},{0x58a8,197},{0x58a9,72},
+	{0x58c1,13},{0x58d5,109},{0x58e4,256},{0x58eb,285},{0x58ec,259},
+	{0x58ee,384},{0x58f0,284},{0x58f3,143},{0x58f6,116},{0x58f9,350},
+	{0x5904,39},{0x5907,10},{0x590d,85},{0x590f,332},{0x5915,331},
+	{0x5916,323},{0x591a,73},{0x591c,349},{0x591f,96},{0x5927,54},
+	{0x5929,311},{0x592a,304},{0x592b,85},{0x592e,347},{0x592f,108},
+	{0x5931,285},{0x5934,316},{0x5937,350},{0x5938,149},{0x5939,125},
+	{0x593a,73},{0x5944,346},{0x5947,241},{0x5948,201},{0x5949,82},
+	{0x594b,81},{0x594e,153},{0x594f,390},{0x5951,241},{0x5954,11},
+	{0x5956,127},{0x5957,307},{0x5960,62},{0x5962,282},{0x5965,4},
+	{0x5973,219},{0x5974,218},{0x5976,201},{0x5978,126},{0x5979,303},
+	{0x597d,109},{0x5982,264},{0x5984,325},{0x5986,384},{0x5987,85},
+	{0x5988,181},{0x598a,259},{0x5992,69},{0x5993,124},{0x5996,348},
+	{0x5999,192},{0x59a5,321},{0x59a8,79},{0x59ae,209},{0x59b9,187},
+	{0x59bb,241},{0x59c6,199},{0x59cb,285},{0x59d0,129},{0x59d1,97},
+	{0x59d3,338},{0x59d4,326},{0x59da,348},{0x59dc,127},{0x59e5,160},
+	{0x59e8,350},{0x59ec,124},{0x59fb,351},{0x59ff,388},{0x5a01,326},
+	{0x5a03,322},{0x5a04,174},{0x5a07,128},{0x5a18,211},{0x5a1c,200},
+	{0x5a1f,135},{0x5a20,283},{0x5a25,74},{0x5a29,191},{0x5a31,356},
+	{0x5a36,251},{0x5a46,239},{0x5a49,324},{0x5a5a,122},{0x5a6a,158},
+	{0x5a74,352},{0x5a76,283},{0x5a7f,341},{0x5a92,187},{0x5a9a,187},
+	{0x5ab3,331},{0x5ac1,125},{0x5ac2,273},{0x5ac9,124},{0x5acc,333},
+	{0x5ae1,61},{0x5ae9,207},{0x5b50,388},{0x5b54,146},{0x5b55,359},
+	{0x5b57,388},{0x5b58,52},{0x5b59,301},{0x5b5c,388},{0x5b5d,335},
+	{0x5b5f,189},{0x5b63,124},{0x5b64,97},{0x5b66,343},{0x5b69,106},
+	{0x5b6a,177},{0x5b70,287},{0x5b75,85},{0x5b7a,264},{0x5b7d,213},
+	{0x5b81,215},{0x5b83,303},{0x5b85,370},{0x5b87,356},{0x5b88,286},
+	{0x5b89,2},{0x5b8b,296},{0x5b8c,324},{0x5b8f,114},{0x5b97,389},
+	{0x5b98,100},{0x5b99,379},{0x5b9a,65},{0x5b9b,324},{0x5b9c,350},
+	{0x5b9d,9},{0x5b9e,285},{0x5ba0,37},{0x5ba1,283},{0x5ba2,143},
+	{0x5ba3,342},{0x5ba4,285},{0x5ba6,119},{0x5baa,333},{0x5bab,95},
+	{0x5bb0,361},{0x5bb3,106},{0x5bb4,346},{0x5bb5,335},{0x5bb6,125},
+	{0x5bb9,262},{0x5bbd,151},{0x5bbe,17},{0x5bbf,298},{0x5bc2,124},
+	{0x5bc4,124},{0x5bc5,351},{0x5bc6,190},{0x5bc7,147},{0x5bcc,85},
+	{0x5bd0,187},{0x5bd2,107},{0x5bd3,356},{0x5bdd,247},{0x5bde,197},
+	{0x5bdf,28},{0x5be1,98},{0x5be5,168},{0x5be8,370},{0x5bf8,52},
+	{0x5bf9,71},{0x5bfa,295},{0x5bfb,344},{0x5bfc,58},{0x5bff,286},
+	{0x5c01,82},{0x5c04,282},{0x5c06,127},{0x5c09,326},{0x5c0a,394},
+	{0x5c0f,335},{0x5c11,281},{0x5c14,76},{0x5c16,126},{0x5c18,34},
+	{0x5c1a,280},{0x5c1d,31},{0x5c24,355},{0x5c27,348},{0x5c31,133},
+	{0x5c38,285},{0x5c39,351},{0x5c3a,36},{0x5c3c,209},{0x5c3d,130},
+	{0x5c3e,326},{0x5c3f,212},{0x5c40,134},{0x5c41,233},{0x5c42,27},
+	{0x5c45,134},{0x5c48,251},{0x5c49,310},{0x5c4a,129},{0x5c4b,330},
+	{0x5c4e,285},{0x5c4f,238},{0x5c51,336},{0x5c55,371},{0x5c5e,287},
+	{0x5c60,317},{0x5c61,176},{0x5c65,176},{0x5c6f,320},{0x5c71,279},
+	{0x5c79,350},{0x5c7f,356},{0x5c81,300},{0x5c82,241},{0x5c94,28},
+	{0x5c97,89},{0x5c9b,58},{0x5ca9,346},{0x5cad,171},{0x5cb3,358},
+	{0x5cb8,2},{0x5cbf,153},{0x5cd9,377},{0x5ce1,332},{0x5ce6,177},
+	{0x5ce8,74},{0x5cea,356},{0x5ced,245},{0x5cf0,82},{0x5cfb,137},
+	{0x5d07,37},{0x5d0e,241},{0x5d14,51},{0x5d16,345},{0x5d29,12},
+	{0x5d2d,371},{0x5d4c,243},{0x5dcd,326},{0x5ddd,41},{0x5dde,379},
+	{0x5de1,344},{0x5de2,32},{0x5de5,95},{0x5de6,395},{0x5de7,245},
+	{0x5de8,134},{0x5de9,95},{0x5deb,330},{0x5dee,28},{0x5df1,124},
+	{0x5df2,350},{0x5df3,295},{0x5df4,5},{0x5df7,334},{0x5dfe,130},
+	{0x5e01,13},{0x5e02,285},{0x5e03,20},{0x5e05,289},{0x5e06,78},
+	{0x5e08,285},{0x5e0c,331},{0x5e10,372},{0x5e15,225},{0x5e16,313},
+	{0x5e18,166},{0x5e1a,379},{0x5e1b,19},{0x5e1c,377},{0x5e1d,61},
+	{0x5e26,55},{0x5e27,376},{0x5e2d,331},{0x5e2e,8},{0x5e38,31},
+	{0x5e3d,185},{0x5e42,190},{0x5e45,85},{0x5e4c,120},{0x5e55,199},
+	{0x5e62,42},{0x5e72,88},{0x5e73,238},{0x5e74,210},{0x5e76,18},
+	{0x5e78,338},{0x5e7b,119},{0x5e7c,355},{0x5e7d,355},{0x5e7f,101},
+	{0x5e84,384},{0x5e86,248},{0x5e87,13},{0x5e8a,42},{0x5e8f,341},
+	{0x5e90,175},{0x5e93,148},{0x5e94,352},{0x5e95,61},{0x5e97,62},
+	{0x5e99,192},{0x5e9a,94},{0x5e9c,85},{0x5e9e,228},{0x5e9f,80},
+	{0x5ea6,69},{0x5ea7,395},{0x5ead,314},{0x5eb6,287},{0x5eb7,141},
+	{0x5eb8,354},{0x5ec9,166},{0x5eca,159},{0x5ed3,155},{0x5ed6,168},
+	{0x5ef6,346},{0x5ef7,314},{0x5efa,126},{0x5f00,139},{0x5f02,350},
+	{0x5f03,241},{0x5f04,217},{0x5f0a,13},{0x5f0f,285},{0x5f13,95},
+	{0x5f15,351},{0x5f17,85},{0x5f18,114},{0x5f1b,36},{0x5f1f,61},
+	{0x5f20,372},{0x5f25,190},{0x5f26,333},{0x5f27,116},{0x5f2f,324},
+	{0x5f31,268},{0x5f39,56},{0x5f3a,244},{0x5f52,102},{0x5f53,57},
+	{0x5f55,175},{0x5f5d,350},{0x5f62,338},{0x5f64,315},{0x5f66,346},
+	{0x5f69,22},{0x5f6a,15},{0x5f6c,17},{0x5f6d,232},{0x5f70,372},
+	{0x5f71,352},{0x5f79,350},{0x5f7b,33},{0x5f7c,13},{0x5f80,325},
+	{0x5f81,376},{0x5f84,131},{0x5f85,55},{0x5f88,112},{0x5f8a,118},
+	{0x5f8b,176},{0x5f90,341},{0x5f92,317},{0x5f97,59},{0x5f98,226},
+	{0x5fa1,356},{0x5faa,344},{0x5fae,326},{0x5fb7,59},{0x5fbd,121},
+	{0x5fc3,337},{0x5fc5,13},{0x5fc6,350},{0x5fcc,124},{0x5fcd,259},
+	{0x5fd7,377},{0x5fd8,325},{0x5fd9,184},{0x5fe0,378},{0x5fe7,355},
+	{0x5feb,150},{0x5ff1,34},{0x5ff5,210},{0x5ffb,337},{0x5ffd,116},
+	{0x5fff,81},{0x6000,118},{0x6001,304},{0x6002,296},{0x600e,367},
+	{0x6012,218},{0x6014,376},{0x6015,225},{0x6016,20},{0x601c,166},
+	{0x601d,295},{0x6020,55},{0x6025,124},{0x6027,338},{0x6028,357},
+	{0x602a,99},{0x602f,246},{0x603b,389},{0x6043,285},{0x604b,166},
+	{0x604d,120},{0x6050,146},{0x6052,113},{0x6055,287},{0x6062,121},
+	{0x6064,341},{0x6068,112},{0x6069,75},{0x606b,67},{0x606c,311},
+	{0x606d,95},{0x606f,331},{0x6070,242},{0x6073,144},{0x6076,74},
+	{0x607c,204},{0x607f,354},{0x6084,245},{0x6089,331},{0x608d,107},
+	{0x6094,121},{0x609f,330},{0x60a0,355},{0x60a3,119},{0x60a6,358},
+	{0x60a8,214},{0x60ac,342},{0x60af,194},{0x60b2,10},{0x60b8,124},
+	{0x60bc,58},{0x60c5,248},{0x60ca,131},{0x60cb,324},{0x60d1,123},
+	{0x60d5,310},{0x60dc,331},{0x60df,326},{0x60e0,121},{0x60e6,62},
+	{0x60e7,134},{0x60e8,23},{0x60e9,35},{0x60eb,10},{0x60ed,23},
+	{0x60ee,56},{0x60ef,100},{0x60f0,73},{0x60f3,334},{0x60f6,120},
+	{0x60f9,258},{0x60fa,338},{0x6101,38},{0x6108,356},{0x6109,356},
+	{0x610f,350},{0x611a,356},{0x611f,88},{0x6124,81},{0x6127,153},
+	{0x613f,357},{0x6148,46},{0x614c,120},{0x614e,283},{0x6151,282},
+	{0x6155,199},{0x6162,183},{0x6167,121},{0x6168,139},{0x6170,326},
+	{0x6177,141},{0x618b,16},{0x618e,368},{0x61a8,107},{0x61be,107},
+	{0x61c2,67},{0x61c8,336},{0x61ca,4},{0x61d2,158},{0x61e6,222},
+	{0x6208,91},{0x620a,330},{0x620c,341},{0x620d,287},{0x620e,262},
+	{0x620f,331},{0x6210,35},{0x6211,329},{0x6212,129},{0x6216,123},
+	{0x6218,371},{0x621a,241},{0x622a,129},{0x622e,175},{0x6233,45},
+	{0x6234,55},{0x6237,116},{0x623f,79},{0x6240,302},{0x6241,14},
+	{0x6247,279},{0x624b,286},{0x624d,22},{0x624e,369},{0x6251,240},
+	{0x6252,5},{0x6253,54},{0x6254,260},{0x6258,321},{0x625b,141},
+	{0x6263,147},{0x6266,243},{0x6267,377},{0x6269,155},{0x626b,273},
+	{0x626c,347},{0x626d,216},{0x626e,7},{0x626f,33},{0x6270,257},
+	{0x6273,7},{0x6276,85},{0x6279,233},{0x627c,74},{0x627e,373},
+	{0x627f,35},{0x6280,124},{0x6284,32},{0x6289,136},{0x628a,5},
+	{0x6291,350},{0x6292,287},{0x6293,381},{0x6295,316},{0x6296,68},
+	{0x6297,141},{0x6298,374},{0x629a,85},{0x629b,229},{0x62a0,147},
+	{0x62a1,179},{0x62a2,244},{0x62a4,116},{0x62a5,9},{0x62a8,232},
+	{0x62ab,233},{0x62ac,304},{0x62b1,9},{0x62b5,61},{0x62b9,197},
+	{0x62bc,345},{0x62bd,38},{0x62bf,194},{0x62c2,85},{0x62c4,380},
+	{0x62c5,56},{0x62c6,29},{0x62c7,199},{0x62c8,210},{0x62c9,156},
+	{0x62cc,7},{0x62cd,226},{0x62ce,170},{0x62d0,99},{0x62d2,134},
+	{0x62d3,321},{0x62d4,5},{0x62d6,321},{0x62d8,134},{0x62d9,387},
+	{0x62db,373},{0x62dc,6},{0x62df,209},{0x62e2,173},{0x62e3,126},
+	{0x62e5,354},{0x62e6,158},{0x62e7,215},{0x62e8,19},{0x62e9,365},
+	{0x62ec,155},{0x62ed,285},{0x62ef,376},{0x62f1,95},{0x62f3,252},
+	{0x62f4,290},{0x62f7,142},{0x62fc,237},{0x62fd,382},{0x62fe,285},
+	{0x62ff,200},{0x6301,36},{0x6302,98},{0x6307,377},{0x6309,2},
+	{0x630e,149},{0x6311,312},{0x6316,322},{0x631a,377},{0x631b,177},
+	{0x631d,329},{0x631e,303},{0x631f,336},{0x6320,204},{0x6321,57},
+	{0x6323,376},{0x6324,124},{0x6325,121},{0x6328,1},{0x632a,222},
+	{0x632b,53},{0x632f,375},{0x633a,314},{0x633d,324},{0x6342,330},
+	{0x6345,315},{0x6346,154},{0x6349,387},{0x634c,5},{0x634d,107},
+	{0x634e,281},{0x634f,213},{0x6350,135},{0x6355,19},{0x635e,160},
+	{0x635f,301},{0x6361,126},{0x6362,119},{0x6363,58},{0x6367,232},
+	{0x636e,134},{0x6376,43},{0x6377,129},{0x637b,210},{0x6380,333},
+	{0x6382,62},{0x6387,73},{0x6388,286},{0x6389,63},{0x638c,372},
+	{0x638f,307},{0x6390,242},{0x6392,226},{0x6396,349},{0x6398,136},
+	{0x63a0,178},{0x63a2,305},{0x63a3,33},{0x63a5,129},{0x63a7,146},
+	{0x63a8,319},{0x63a9,346},{0x63aa,53},{0x63b3,175},{0x63b7,377},
+	{0x63b8,56},{0x63ba,30},{0x63c9,263},{0x63cd,390},{0x63cf,192},
+	{0x63d0,310},{0x63d2,28},{0x63d6,350},{0x63e1,329},{0x63e3,40},
+	{0x63e9,139},{0x63ea,133},{0x63ed,129},{0x63f4,357},{0x63fd,158},
+	{0x6400,30},{0x6401,91},{0x6402,174},{0x6405,128},{0x640f,19},
+	{0x6410,39},{0x6413,53},{0x6414,273},{0x641c,297},{0x641e,90},
+	{0x642a,306},{0x642c,7},{0x642d,54},{0x643a,336},{0x643d,28},
+	{0x6444,282},{0x6446,6},{0x6447,348},{0x6448,17},{0x644a,305},
+	{0x6454,289},{0x6458,370},{0x6467,51},{0x6469,197},{0x6478,197},
+	{0x6479,197},{0x6482,168},{0x6485,136},{0x6487,236},{0x6491,35},
+	{0x6492,269},{0x6495,295},{0x649e,384},{0x64a4,33},{0x64a9,168},
+	{0x64ac,245},{0x64ad,19},{0x64ae,53},{0x64b0,383},{0x64b5,210},
+	{0x64bc,107},{0x64c2,162},{0x64c5,279},{0x64cd,25},{0x64ce,248},
+	{0x64d2,247},{0x64de,297},{0x64e6,21},{0x6500,227},{0x6512,362},
+	{0x6518,256},{0x652b,136},{0x652f,377},{0x6536,286},{0x6539,87},
+	{0x653b,95},{0x653e,79},{0x653f,376},{0x6545,97},{0x6548,335},
+	{0x654c,61},{0x654f,194},{0x6551,133},{0x6556,4},{0x6559,128},
+	{0x655b,166},{0x655d,13},{0x655e,31},{0x6562,88},{0x6563,271},
+	{0x6566,72},{0x656c,131},{0x6570,287},{0x6572,245},{0x6574,376},
+	{0x6577,85},{0x6587,327},{0x658b,370},{0x658c,17},{0x6591,7},
+	{0x6597,68},{0x6599,168},{0x659c,336},{0x659f,375},{0x65a1,329},
+	{0x65a4,130},{0x65a5,36},{0x65a7,85},{0x65a9,371},{0x65ad,70},
+	{0x65af,295},{0x65b0,337},{0x65b9,79},{0x65bd,285},{0x65c1,228},
+	{0x65c5,176},{0x65cb,342},{0x65cf,391},{0x65d7,241},{0x65e0,330},
+	{0x65e2,124},{0x65e5,261},{0x65e6,56},{0x65e7,133},{0x65e8,377},
+	{0x65e9,364},{0x65ec,344},{0x65ed,341},{0x65f1,107},{0x65f6,285},
+	{0x65f7,152},{0x65fa,325},{0x6602,3},{0x6606,154},{0x660c,31},
+	{0x660e,195},{0x660f,122},{0x6613,350},{0x6614,331},{0x661f,338},
+	{0x6620,352},{0x6625,44},{0x6627,187},{0x6628,395},{0x662d,373},
+	{0x662f,285},{0x663c,379},{0x663e,333},{0x6643,120},{0x664b,130},
+	{0x664c,280},{0x6652,278},{0x6653,335},{0x6655,359},{0x665a,324},
+	{0x6664,330},{0x6666,121},{0x6668,34},{0x666e,240},{0x666f,131},
+	{0x6670,331},{0x6674,248},{0x6676,131},{0x667a,377},{0x667e,167},
+	{0x6682,362},{0x6687,332},{0x6691,287},{0x6696,220},{0x6697,2},
+	{0x66ae,199},{0x66b4,9},{0x66d9,287},{0x66dd,240},{0x66f0,358},
+	{0x66f2,251},{0x66f3,349},{0x66f4,94},{0x66f9,25},{0x66fc,183},
+	{0x66fe,368},{0x66ff,310},{0x6700,393},{0x6708,358},{0x6709,355},
+	{0x670b,232},{0x670d,85},{0x6714,294},{0x6717,159},{0x671b,325},
+	{0x671d,32},{0x671f,241},{0x6728,199},{0x672a,326},{0x672b,197},
+	{0x672c,11},{0x672d,369},{0x672f,287},{0x6731,380},{0x6734,240},
+	{0x6735,73},{0x673a,124},{0x673d,340},{0x6740,277},{0x6742,360},
+	{0x6743,252},{0x6746,88},{0x6749,279},{0x674e,164},{0x674f,338},
+	{0x6750,22},{0x6751,52},{0x6756,372},{0x675c,69},{0x675f,287},
+	{0x6760,89},{0x6761,312},{0x6765,157},{0x6768,347},{0x676d,108},
+	{0x676f,10},{0x6770,129},{0x677e,296},{0x677f,7},{0x6781,124},
+	{0x6784,96},{0x6789,325},{0x6790,331},{0x6795,375},{0x6797,170},
+	{0x679a,187},{0x679c,104},{0x679d,377},{0x67a2,287},{0x67a3,364},
+	{0x67aa,244},{0x67ab,82},{0x67af,148},{0x67b6,125},{0x67b7,125},
+	{0x67c4,18},{0x67cf,6},{0x67d0,198},{0x67d1,88},{0x67d2,241},
+	{0x67d3,255},{0x67d4,263},{0x67dc,102},{0x67de,395},{0x67e0,215},
+	{0x67e5,28},{0x67ec,126},{0x67ef,143},{0x67f1,380},{0x67f3,172},
+	{0x67f4,29},{0x67ff,285},{0x6805,369},{0x6807,15},{0x6808,371},
+	{0x680b,67},{0x680f,158},{0x6811,287},{0x6813,290},{0x6816,241},
+	{0x6817,164},{0x6821,335},{0x682a,380},{0x6837,347},{0x6838,110},
+	{0x6839,93},{0x683c,91},{0x683d,361},{0x6842,102},{0x6843,307},
+	{0x6845,326},{0x6846,152},{0x6848,2},{0x684c,387},{0x6850,315},
+	{0x6851,272},{0x6853,119},{0x6854,129},{0x6863,57},{0x6865,245},
+	{0x6868,127},{0x6869,384},{0x6876,315},{0x6881,167},{0x6885,187},
+	{0x6886,8},{0x6897,94},{0x68a2,281},{0x68a6,189},{0x68a7,330},
+	{0x68a8,164},{0x68ad,302},{0x68af,310},{0x68b0,336},{0x68b3,287},
+	{0x68c0,126},{0x68c9,191},{0x68cb,241},{0x68cd,103},{0x68d2,8},
+	{0x68d5,389},{0x68d8,124},{0x68da,232},{0x68e0,306},{0x68ee,275},
+	{0x68f1,163},{0x68f5,143},{0x68fa,100},{0x6905,350},{0x690d,377},
+	{0x690e,385},{0x6912,128},{0x692d,321},{0x6930,349},{0x693d,41},
+	{0x693f,44},{0x6954,336},{0x695a,39},{0x695e,163},{0x6977,139},
+	{0x697c,174},{0x6982,87},{0x6986,356},{0x6994,159},{0x699c,8},
+	{0x69a8,369},{0x69b4,172},{0x69b7,253},{0x69d0,118},{0x69db,126},
+	{0x69fd,25},{0x6a0a,78},{0x6a1f,372},{0x6a21,197},{0x6a2a,113},
+	{0x6a31,352},{0x6a47,245},{0x6a59,35},{0x6a61,334},{0x6a71,39},
+	{0x6a80,305},{0x6a84,331},{0x6aac,189},{0x6b20,243},{0x6b21,46},
+	{0x6b22,119},{0x6b23,337},{0x6b27,224},{0x6b32,356},{0x6b3a,241},
+	{0x6b3e,151},{0x6b47,336},{0x6b49,243},{0x6b4c,91},{0x6b62,377},
+	{0x6b63,376},{0x6b64,46},{0x6b65,20},{0x6b66,330},{0x6b67,241},
+	{0x6b6a,323},{0x6b79,55},{0x6b7b,295},{0x6b7c,126},{0x6b83,347},
+	{0x6b86,55},{0x6b89,344},{0x6b8a,287},{0x6b8b,23},{0x6b96,377},
+	{0x6bb4,224},{0x6bb5,70},{0x6bb7,351},{0x6bbf,62},{0x6bc1,121},
+	{0x6bc5,350},{0x6bcb,330},{0x6bcd,199},{0x6bcf,187},{0x6bd2,69},
+	{0x6bd4,13},{0x6bd5,13},{0x6bd6,13},{0x6bd7,233},{0x6bd9,13},
+	{0x6bdb,185},{0x6be1,371},{0x6beb,109},{0x6bef,305},{0x6c0f,285},
+	{0x6c11,194},{0x6c13,184},{0x6c14,241},{0x6c16,201},{0x6c1b,81},
+	{0x6c1f,85},{0x6c22,248},{0x6c26,106},{0x6c27,347},{0x6c28,2},
+	{0x6c2e,56},{0x6c2f,176},{0x6c30,248},{0x6c34,292},{0x6c38,354},
+	{0x6c40,314},{0x6c41,377},{0x6c42,250},{0x6c47,121},{0x6c49,107},
+	{0x6c50,331},{0x6c55,279},{0x6c57,107},{0x6c5b,344},{0x6c5d,264},
+	{0x6c5e,95},{0x6c5f,127},{0x6c60,36},{0x6c61,330},{0x6c64,306},
+	{0x6c6a,325},{0x6c70,304},{0x6c72,124},{0x6c79,339},{0x6c7d,241},
+	{0x6c7e,81},{0x6c81,247},{0x6c82,350},{0x6c83,329},{0x6c88,283},
+	{0x6c89,34},{0x6c8f,241},{0x6c99,277},{0x6c9b,230},{0x6c9f,96},
+	{0x6ca1,187},{0x6ca4,224},{0x6ca5,164},{0x6ca6,179},{0x6ca7,24},
+	{0x6caa,116},{0x6cab,197},{0x6cae,134},{0x6cb3,110},{0x6cb8,80},
+	{0x6cb9,355},{0x6cbb,377},{0x6cbc,373},{0x6cbd,97},{0x6cbe,371},
+	{0x6cbf,346},{0x6cc4,336},{0x6cc5,250},{0x6cc9,252},{0x6cca,19},
+	{0x6ccc,190},{0x6cd5,77},{0x6cdb,78},{0x6cde,215},{0x6ce1,229},
+	{0x6ce2,19},{0x6ce3,241},{0x6ce5,209},{0x6ce8,380},{0x6cea,162},
+	{0x6cf0,304},{0x6cf3,354},{0x6cf5,12},{0x6cfb,336},{0x6cfc,239},
+	{0x6cfd,365},{0x6d01,129},{0x6d0b,347},{0x6d12,269},{0x6d17,331},
+	{0x6d1b,180},{0x6d1e,67},{0x6d25,130},{0x6d2a,114},{0x6d31,76},
+	{0x6d32,379},{0x6d3b,123},{0x6d3c,322},{0x6d3d,242},{0x6d3e,226},
+	{0x6d41,172},{0x6d45,243},{0x6d46,127},{0x6d47,128},{0x6d4a,387},
+	{0x6d4b,26},{0x6d4e,124},{0x6d51,122},{0x6d53,217},{0x6d59,374},
+	{0x6d5a,137},{0x6d66,240},{0x6d69,109},{0x6d6a,159},{0x6d6e,85},
+	{0x6d74,356},{0x6d77,106},{0x6d78,130},{0x6d82,317},{0x6d85,213},
+	{0x6d88,335},{0x6d89,282},{0x6d8c,354},{0x6d8e,333},{0x6d95,310},
+	{0x6d9b,307},{0x6d9d,160},{0x6d9f,166},{0x6da1,329},{0x6da3,119},
+	{0x6da4,61},{0x6da6,267},{0x6da7,126},{0x6da8,372},{0x6da9,274},
+	{0x6daa,85},{0x6daf,345},{0x6db2,349},{0x6db5,107},{0x6db8,110},
+	{0x6dc0,62},{0x6dc4,388},{0x6dc6,335},{0x6dcb,170},{0x6dcc,306},
+	{0x6dd1,287},{0x6dd6,204},{0x6dd8,307},{0x6de1,56},{0x6de4,356},
+	{0x6deb,351},{0x6dec,51},{0x6dee,118},{0x6df1,283},{0x6df3,44},
+	{0x6df7,122},{0x6df9,346},{0x6dfb,311},{0x6e05,248},{0x6e0a,357},
+	{0x6e0d,388},{0x6e10,126},{0x6e14,356},{0x6e17,283},{0x6e1d,356},
+	{0x6e20,251},{0x6e21,69},{0x6e23,369},{0x6e24,19},{0x6e29,327},
+	{0x6e2d,326},{0x6e2f,89},{0x6e34,143},{0x6e38,355},{0x6e3a,192},
+	{0x6e43,226},{0x6e4d,318},{0x6e56,116},{0x6e58,334},{0x6e5b,371},
+	{0x6e7e,324},{0x6e7f,285},{0x6e83,153},{0x6e85,126},{0x6e89,87},
+	{0x6e90,357},{0x6e9c,172},{0x6ea2,350},{0x6eaa,331},{0x6eaf,298},
+	{0x6eb6,262},{0x6eba,209},{0x6ec1,39},{0x6ec7,62},{0x6ecb,388},
+	{0x6ed1,117},{0x6ed3,388},{0x6ed4,307},{0x6eda,103},{0x6ede,377},
+	{0x6ee1,183},{0x6ee4,176},{0x6ee5,158},{0x6ee6,177},{0x6ee8,17},
+	{0x6ee9,305},{0x6ef4,61},{0x6f02,235},{0x6f06,241},{0x6f0f,174},
+	{0x6f13,164},{0x6f14,346},{0x6f20,197},{0x6f2b,183},{0x6f31,287},
+	{0x6f33,372},{0x6f3e,347},{0x6f4d,326},{0x6f58,227},{0x6f5c,243},
+	{0x6f5e,175},{0x6f66,168},{0x6f6d,305},{0x6f6e,32},{0x6f84,35},
+	{0x6f88,33},{0x6f8e,232},{0x6f9c,158},{0x6fa1,364},{0x6fb3,4},
+	{0x6fc0,124},{0x6fd2,17},{0x7011,240},{0x704c,100},{0x706b,123},
+	{0x706d,193},{0x706f,60},{0x7070,121},{0x7075,171},{0x7076,364},
+	{0x7078,133},{0x707c,387},{0x707e,361},{0x707f,23},{0x7089,175},
+	{0x708a,43},{0x708e,346},{0x7092,32},{0x7094,253},{0x7095,141},
+	{0x7099,377},{0x70ac,134},{0x70ad,305},{0x70ae,229},{0x70af,132},
+	{0x70b3,18},{0x70b8,369},{0x70b9,62},{0x70bc,166},{0x70bd,36},
+	{0x70c1,294},{0x70c2,158},{0x70c3,314},{0x70c8,169},{0x70d8,114},
+	{0x70d9,160},{0x70db,380},{0x70df,346},{0x70e4,142},{0x70e6,78},
+	{0x70e7,281},{0x70e9,121},{0x70eb,306},{0x70ec,130},{0x70ed,258},
+	{0x70ef,331},{0x70f7,324},{0x70f9,232},{0x70fd,82},{0x7109,346},
+	{0x710a,107},{0x7115,119},{0x7119,10},{0x711a,81},{0x7126,128},
+	{0x7130,346},{0x7136,255},{0x714c,120},{0x714e,126},{0x715e,277},
+	{0x7164,187},{0x7167,373},{0x716e,380},{0x717d,279},{0x7184,331},
+	{0x718a,339},{0x718f,344},{0x7194,262},{0x7199,331},{0x719f,287},
+	{0x71ac,4},{0x71c3,255},{0x71ce,168},{0x71d5,346},{0x71e5,364},
+	{0x7206,9},{0x722a,381},{0x722c,225},{0x7231,1},{0x7235,136},
+	{0x7236,85},{0x7237,349},{0x7238,5},{0x7239,64},{0x723d,291},
+	{0x7247,234},{0x7248,7},{0x724c,226},{0x7259,345},{0x725b,216},
+	{0x725f,198},{0x7261,199},{0x7262,160},{0x7267,199},{0x7269,330},
+	{0x7272,284},{0x7275,243},{0x7279,308},{0x727a,331},{0x7280,331},
+	{0x7281,164},{0x728a,69},{0x72ac,252},{0x72af,78},{0x72b6,384},
+	{0x72b9,355},{0x72c2,152},{0x72c4,61},{0x72c8,10},{0x72d0,116},
+	{0x72d7,96},{0x72d9,134},{0x72de,215},{0x72e0,112},{0x72e1,128},
+	{0x72ec,69},{0x72ed,332},{0x72ee,285},{0x72f0,376},{0x72f1,356},
+	{0x72f8,164},{0x72fc,159},{0x730e,169},{0x7316,31},{0x731b,189},
+	{0x731c,22},{0x7329,338},{0x732a,380},{0x732b,185},{0x732e,333},
+	{0x7334,115},{0x733e,117},{0x733f,357},{0x736d,303},{0x7384,342},
+	{0x7387,176},{0x7389,356},{0x738b,325},{0x7396,133},{0x739b,181},
+	{0x73a9,324},{0x73ab,187},{0x73af,119},{0x73b0,333},{0x73b2,171},
+	{0x73bb,19},{0x73ca,279},{0x73cd,375},{0x73d0,77},{0x73e0,380},
+	{0x73ed,7},{0x7403,250},{0x7405,159},{0x7406,164},{0x7409,172},
+	{0x7410,302},{0x7422,387},{0x7433,170},{0x7434,247},{0x7435,233},
+	{0x7436,225},{0x743c,249},{0x745a,116},{0x745e,266},{0x745f,274},
+	{0x7470,102},{0x7476,348},{0x7483,164},{0x74dc,98},{0x74e2,235},
+	{0x74e3,7},{0x74e4,256},{0x74e6,322},{0x74ee,328},{0x74f6,238},
+	{0x74f7,46},{0x7504,375},{0x7518,88},{0x751a,283},{0x751c,311},
+	{0x751f,284},{0x7525,284},{0x7528,354},{0x7529,289},{0x752b,85},
+	{0x752d,12},{0x7530,311},{0x7531,355},{0x7532,125},{0x7533,283},
+	{0x7535,62},{0x7537,202},{0x7538,62},{0x753b,117},{0x7545,31},
+	{0x754c,129},{0x754f,326},{0x7554,227},{0x7559,172},{0x755c,341},
+	{0x7565,178},{0x7566,241},{0x756a,78},{0x7574,38},{0x7578,124},
+	{0x7586,127},{0x758f,287},{0x7591,350},{0x7597,168},{0x7599,91},
+	{0x759a,133},{0x759f,221},{0x75a1,347},{0x75a4,5},{0x75a5,129},
+	{0x75ab,350},{0x75ae,42},{0x75af,82},{0x75b2,233},{0x75b5,46},
+	{0x75b9,375},{0x75bc,309},{0x75bd,134},{0x75be,124},{0x75c5,18},
+	{0x75c7,376},{0x75c8,354},{0x75c9,131},{0x75ca,252},{0x75d2,347},
+	{0x75d4,377},{0x75d5,112},{0x75d8,68},{0x75db,315},{0x75de,233},
+	{0x75e2,164},{0x75ea,119},{0x75f0,305},{0x75f4,36},{0x75f9,13},
+	{0x7601,51},{0x761f,327},{0x7624,172},{0x7626,286},{0x7629,54},
+	{0x762a,16},{0x762b,305},{0x7634,372},{0x7638,253},{0x764c,1},
+	{0x7663,342},{0x7678,102},{0x767b,60},{0x767d,6},{0x767e,6},
+	{0x7682,364},{0x7684,59},{0x7686,129},{0x7687,120},{0x768b,90},
+	{0x7691,1},{0x7696,324},{0x76ae,233},{0x76b1,379},{0x76bf,194},
+	{0x76c2,356},{0x76c5,378},{0x76c6,231},{0x76c8,352},{0x76ca,350},
+	{0x76ce,3},{0x76cf,371},{0x76d0,346},{0x76d1,126},{0x76d2,110},
+	{0x76d4,153},{0x76d6,87},{0x76d7,58},{0x76d8,227},{0x76db,284},
+	{0x76df,189},{0x76ee,199},{0x76ef,65},{0x76f2,184},{0x76f4,377},
+	{0x76f8,334},{0x76fc,227},{0x76fe,72},{0x7701,284},{0x7709,187},
+	{0x770b,140},{0x771f,375},{0x7720,191},{0x7728,369},{0x7729,342},
+	{0x772f,190},{0x7736,152},{0x7737,135},{0x773a,312},{0x773c,346},
+	{0x7740,387},{0x7741,376},{0x775b,131},{0x7761,292},{0x7763,69},
+	{0x7766,199},{0x776b,129},{0x776c,22},{0x7779,69},{0x7784,192},
+	{0x7785,38},{0x778e,332},{0x7792,183},{0x77a5,236},{0x77a7,245},
+	{0x77a9,380},{0x77aa,60},{0x77ac,293},{0x77b3,315},{0x77bb,371},
+	{0x77d7,39},{0x77db,185},{0x77e2,285},{0x77e3,350},{0x77e5,377},
+	{0x77e9,134},{0x77eb,128},{0x77ed,70},{0x77ee,1},{0x77f3,285},
+	{0x77fd,331},{0x77fe,78},{0x77ff,152},{0x7801,181},{0x7802,277},
+	{0x780c,241},{0x780d,140},{0x7812,233},{0x7814,346},{0x7816,383},
+	{0x781a,346},{0x7827,375},{0x7830,232},{0x7834,239},{0x7837,283},
+	{0x7838,360},{0x783e,164},{0x7840,39},{0x7845,102},{0x7852,331},
+	{0x7855,294},{0x785d,335},{0x786b,172},{0x786c,352},{0x786e,253},
+	{0x7877,126},{0x787c,232},{0x7889,63},{0x788c,175},{0x788d,1},
+	{0x788e,300},{0x7891,10},{0x7897,324},{0x7898,62},{0x789f,64},
+	{0x78a7,13},{0x78b0,232},{0x78b1,126},{0x78b3,305},{0x78b4,28},
+	{0x78be,210},{0x78c1,46},{0x78c5,8},{0x78ca,162},{0x78cb,53},
+	{0x78d0,227},{0x78d5,143},{0x78e8,197},{0x78f7,170},{0x78fa,120},
+	{0x7901,128},{0x793a,285},{0x793c,164},{0x793e,282},{0x7941,241},
+	{0x7948,241},{0x7956,391},{0x795d,380},{0x795e,283},{0x795f,300},
+	{0x7965,334},{0x7968,235},{0x796d,124},{0x7977,58},{0x7978,123},
+	{0x7981,130},{0x7984,175},{0x798f,85},{0x79b9,356},{0x79bb,164},
+	{0x79bd,247},{0x79be,110},{0x79c0,340},{0x79c1,295},{0x79c3,317},
+	{0x79c6,88},{0x79c9,18},{0x79cb,250},{0x79cd,378},{0x79d1,143},
+	{0x79d2,192},{0x79d8,190},{0x79df,391},{0x79e4,35},{0x79e6,247},
+	{0x79e7,347},{0x79e9,377},{0x79ef,124},{0x79f0,35},{0x79f8,129},
+	{0x79fb,350},{0x79fd,121},{0x7a00,331},{0x7a0b,35},{0x7a0d,281},
+	{0x7a0e,292},{0x7a17,6},{0x7a1a,377},{0x7a20,38},{0x7a33,327},
+	{0x7a3b,58},{0x7a3c,125},{0x7a3d,124},{0x7a3f,90},{0x7a46,199},
+	{0x7a57,300},{0x7a74,343},{0x7a76,133},{0x7a77,249},{0x7a7a,146},
+	{0x7a7f,41},{0x7a81,317},{0x7a83,246},{0x7a84,370},{0x7a8d,245},
+	{0x7a91,348},{0x7a92,377},{0x7a96,128},{0x7a97,42},{0x7a98,132},
+	{0x7a9c,50},{0x7a9d,329},{0x7a9f,148},{0x7aa5,153},{0x7abf,173},
+	{0x7acb,164},{0x7ad6,287},{0x7ad9,371},{0x7ade,131},{0x7adf,131},
+	{0x7ae0,372},{0x7ae3,137},{0x7ae5,315},{0x7aed,129},{0x7aef,70},
+	{0x7af9,380},{0x7aff,88},{0x7b06,5},{0x7b0b,301},{0x7b11,335},
+	{0x7b14,13},{0x7b1b,61},{0x7b26,85},{0x7b28,11},{0x7b2c,61},
+	{0x7b3a,126},{0x7b3c,173},{0x7b49,60},{0x7b4b,130},{0x7b4f,77},
+	{0x7b50,152},{0x7b51,380},{0x7b52,315},{0x7b54,54},{0x7b56,26},
+	{0x7b5b,278},{0x7b77,150},{0x7b79,38},{0x7b7e,243},{0x7b80,126},
+	{0x7b8d,97},{0x7b94,19},{0x7b95,124},{0x7b97,299},{0x7ba1,100},
+	{0x7ba9,180},{0x7bad,126},{0x7bb1,334},{0x7bc6,383},{0x7bc7,234},
+	{0x7bd3,174},{0x7bd9,90},{0x7be1,50},{0x7bee,158},{0x7bf1,164},
+	{0x7bf7,232},{0x7c07,49},{0x7c27,120},{0x7c3f,20},{0x7c4d,124},
+	{0x7c73,190},{0x7c7b,162},{0x7c7d,388},{0x7c89,81},{0x7c92,164},
+	{0x7c95,239},{0x7c97,49},{0x7c98,371},{0x7c9f,298},{0x7ca4,358},
+	{0x7ca5,379},{0x7caa,81},{0x7cae,167},{0x7cb1,167},{0x7cb3,131},
+	{0x7cb9,51},{0x7cbe,131},{0x7cca,116},{0x7cd5,90},{0x7cd6,306},
+	{0x7cd9,25},{0x7cdc,190},{0x7cdf,364},{0x7ce0,141},{0x7cef,222},
+	{0x7cfb,331},{0x7d0a,327},{0x7d20,298},{0x7d22,302},{0x7d27,130},
+	{0x7d2b,388},{0x7d2f,162},{0x7d6e,341},{0x7e41,78},{0x7e82,392},
+	{0x7ea0,133},{0x7ea2,114},{0x7ea4,333},{0x7ea6,358},{0x7ea7,124},
+	{0x7eaa,124},{0x7eab,259},{0x7eac,326},{0x7eaf,44},{0x7eb1,277},
+	{0x7eb2,89},{0x7eb3,200},{0x7eb5,389},{0x7eb6,179},{0x7eb7,81},
+	{0x7eb8,377},{0x7eb9,327},{0x7eba,79},{0x7ebd,216},{0x7ebf,333},
+	{0x7ec3,166},{0x7ec4,391},{0x7ec5,283},{0x7ec6,331},{0x7ec7,377},
+	{0x7ec8,378},{0x7eca,7},{0x7ecd,281},{0x7ece,350},{0x7ecf,131},
+	{0x7ed1,8},{0x7ed2,262},{0x7ed3,129},{0x7ed5,257},{0x7ed8,121},
+	{0x7ed9,92},{0x7eda,342},{0x7edc,180},{0x7edd,136},{0x7ede,128},
+	{0x7edf,315},{0x7ee2,135},{0x7ee3,340},{0x7ee5,300},{0x7ee6,307},
+	{0x7ee7,124},{0x7ee9,124},{0x7eea,341},{0x7eed,341},{0x7ef0,45},
+	{0x7ef3,284},{0x7ef4,326},{0x7ef5,191},{0x7ef7,12},{0x7ef8,38},
+	{0x7efc,389},{0x7efd,371},{0x7eff,176},{0x7f00,385},{0x7f04,126},
+	{0x7f05,191},{0x7f06,158},{0x7f09,124},{0x7f0e,70},{0x7f13,119},
+	{0x7f14,61},{0x7f15,176},{0x7f16,14},{0x7f18,357},{0x7f1a,85},
+	{0x7f1d,82},{0x7f20,30},{0x7f28,352},{0x7f29,302},{0x7f2e,279},
+	{0x7f34,128},{0x7f38,89},{0x7f3a,253},{0x7f50,100},{0x7f51,325},
+	{0x7f55,107},{0x7f57,180},{0x7f5a,77},{0x7f62,5},{0x7f69,373},
+	{0x7f6a,393},{0x7f6e,377},{0x7f72,287},{0x7f8a,347},{0x7f8c,244},
+	{0x7f8e,187},{0x7f94,90},{0x7f9a,171},{0x7f9e,340},{0x7fa1,333},
+	{0x7fa4,254},{0x7fb9,94},{0x7fbd,356},{0x7fc1,328},{0x7fc5,36},
+	{0x7fcc,350},{0x7fd4,334},{0x7fd8,245},{0x7fdf,61},{0x7fe0,51},
+	{0x7ff0,107},{0x7ff1,4},{0x7ffb,78},{0x7ffc,350},{0x8000,348},
+	{0x8001,160},{0x8003,142},{0x8005,374},{0x800c,76},{0x800d,288},
+	{0x8010,201},{0x8015,94},{0x8017,109},{0x8018,359},{0x8019,5},
+	{0x802a,228},{0x8033,76},{0x8036,349},{0x8038,296},{0x803b,36},
+	{0x803d,56},{0x803f,94},{0x8042,213},{0x804a,168},{0x804b,173},
+	{0x804c,377},{0x8054,166},{0x8058,237},{0x805a,134},{0x806a,47},
+	{0x8083,298},{0x8084,350},{0x8086,295},{0x8087,373},{0x8089,263},
+	{0x808b,162},{0x808c,124},{0x8096,335},{0x8098,379},{0x809a,69},
+	{0x809b,89},{0x809d,88},{0x80a0,31},{0x80a1,97},{0x80a2,377},
+	{0x80a4,85},{0x80a5,80},{0x80a9,126},{0x80aa,79},{0x80ae,3},
+	{0x80af,144},{0x80b2,356},{0x80ba,80},{0x80be,283},{0x80bf,378},
+	{0x80c0,372},{0x80c1,336},{0x80c3,326},{0x80c6,56},{0x80cc,10},
+	{0x80ce,304},{0x80d6,228},{0x80da,230},{0x80dc,284},{0x80de,9},
+	{0x80e1,116},{0x80ef,149},{0x80f0,350},{0x80f3,91},{0x80f6,128},
+	{0x80f8,339},{0x80fa,2},{0x80fd,208},{0x8102,377},{0x8106,51},
+	{0x8109,182},{0x810a,124},{0x810f,363},{0x8110,241},{0x8111,204},
+	{0x8113,217},{0x8116,19},{0x811a,128},{0x812f,85},{0x8131,321},
+	{0x8138,166},{0x813e,233},{0x8146,311},{0x814a,156},{0x814b,349},
+	{0x8150,85},{0x8151,85},{0x8154,244},{0x8155,324},{0x8165,338},
+	{0x816e,270},{0x8170,348},{0x8179,85},{0x817a,333},{0x817b,209},
+	{0x817e,309},{0x817f,319},{0x8180,8},{0x818a,19},{0x818f,90},
+	{0x8198,15},{0x819b,306},{0x819c,197},{0x819d,331},{0x81a8,232},
+	{0x81b3,279},{0x81c0,320},{0x81c2,13},{0x81c3,354},{0x81c6,350},
+	{0x81e3,34},{0x81ea,388},{0x81ed,38},{0x81f3,377},{0x81f4,377},
+	{0x81fb,375},{0x81fc,133},{0x8200,348},{0x8205,133},{0x8206,356},
+	{0x820c,282},{0x820d,282},{0x8212,287},{0x8214,311},{0x821c,293},
+	{0x821e,330},{0x821f,379},{0x822a,108},{0x822c,7},{0x8230,126},
+	{0x8231,24},{0x8235,73},{0x8236,19},{0x8237,333},{0x8239,41},
+	{0x8247,314},{0x8258,297},{0x826f,167},{0x8270,126},{0x8272,274},
+	{0x8273,346},{0x827a,350},{0x827e,1},{0x8282,129},{0x828b,356},
+	{0x828d,281},{0x8292,184},{0x829c,330},{0x829d,377},{0x82a5,129},
+	{0x82a6,175},{0x82ac,81},{0x82ad,5},{0x82af,337},{0x82b1,117},
+	{0x82b3,79},{0x82b9,247},{0x82bd,345},{0x82c7,326},{0x82cd,24},
+	{0x82cf,298},{0x82d1,357},{0x82d4,304},{0x82d7,192},{0x82db,143},
+	{0x82de,9},{0x82df,96},{0x82e5,268},{0x82e6,148},{0x82eb,279},
+	{0x82ef,11},{0x82f1,352},{0x82f9,238},{0x8301,387},{0x8302,185},
+	{0x8303,78},{0x8304,246},{0x8305,185},{0x830e,131},{0x8327,126},
+	{0x8328,46},{0x832b,184},{0x832c,28},{0x8335,351},{0x8336,28},
+	{0x8338,262},{0x8339,264},{0x8346,131},{0x8349,25},{0x8350,126},
+	{0x8352,120},{0x8354,164},{0x835a,125},{0x8361,57},{0x8363,262},
+	{0x8364,122},{0x8367,352},{0x836b,351},{0x836f,348},{0x8377,110},
+	{0x8386,240},{0x8389,164},{0x838e,277},{0x83ab,197},{0x83b1,157},
+	{0x83b2,166},{0x83b7,123},{0x83b9,352},{0x83bd,184},{0x83c7,97},
+	{0x83ca,134},{0x83cc,137},{0x83cf,110},{0x83dc,22},{0x83e0,19},
+	{0x83e9,240},{0x83f1,171},{0x83f2,80},{0x8404,307},{0x840c,189},
+	{0x840d,238},{0x840e,326},{0x841d,180},{0x8424,352},{0x8425,352},
+	{0x8427,335},{0x8428,269},{0x843d,180},{0x8457,380},{0x845b,91},
+	{0x8461,240},{0x8463,67},{0x846b,116},{0x846c,363},{0x8471,47},
+	{0x8475,153},{0x8482,61},{0x848b,127},{0x8499,189},{0x849c,299},
+	{0x84b2,240},{0x84b8,376},{0x84c4,341},{0x84c9,262},{0x84d1,302},
+	{0x84d6,13},{0x84dd,158},{0x84df,124},{0x84ec,232},{0x8511,193},
+	{0x8513,183},{0x8517,374},{0x851a,326},{0x8521,22},{0x852b,210},
+	{0x852c,287},{0x8537,244},{0x853c,1},{0x853d,13},{0x8549,128},
+	{0x854a,266},{0x8574,359},{0x857e,162},{0x8584,9},{0x859b,343},
+	{0x85aa,337},{0x85af,287},{0x85c9,129},{0x85cf,24},{0x85d0,192},
+	{0x85d5,224},{0x85e4,309},{0x85e9,78},{0x85fb,364},{0x8611,197},
+	{0x8638,371},{0x864e,116},{0x864f,175},{0x8650,221},{0x8651,176},
+	{0x865a,341},{0x865e,356},{0x866b,37},{0x8671,285},{0x8679,114},
+	{0x867d,300},{0x867e,332},{0x8680,285},{0x8681,350},{0x8682,181},
+	{0x868a,327},{0x868c,8},{0x8695,23},{0x869c,345},{0x86a4,364},
+	{0x86c0,380},{0x86c6,251},{0x86c7,282},{0x86ca,97},{0x86cb,56},
+	{0x86d4,121},{0x86d9,322},{0x86db,380},{0x86e4,91},{0x86ee,183},
+	{0x86f0,374},{0x86f9,354},{0x86fe,74},{0x8700,287},{0x8702,82},
+	{0x8712,346},{0x8715,319},{0x8717,329},{0x8718,377},{0x871c,190},
+	{0x8721,156},{0x8747,352},{0x8749,30},{0x874e,336},{0x8757,120},
+	{0x8774,116},{0x8776,64},{0x878d,262},{0x879f,195},{0x87ba,180},
+	{0x87f9,336},{0x8815,264},{0x8822,44},{0x8840,343},{0x8845,337},
+	{0x884c,338},{0x884d,346},{0x8854,333},{0x8857,129},{0x8859,345},
+	{0x8861,113},{0x8863,350},{0x8865,20},{0x8868,15},{0x886b,279},
+	{0x886c,34},{0x8870,289},{0x8877,378},{0x8881,357},{0x8884,4},
+	{0x888b,55},{0x888d,229},{0x8892,305},{0x8896,340},{0x889c,322},
+	{0x88ab,10},{0x88ad,331},{0x88b1,85},{0x88c1,22},{0x88c2,169},
+	{0x88c5,384},{0x88d4,350},{0x88d5,356},{0x88d9,254},{0x88e4,148},
+	{0x88f3,280},{0x88f4,230},{0x88f8,180},{0x88f9,104},{0x8902,98},
+	{0x8910,110},{0x8912,9},{0x8925,264},{0x892a,319},{0x8944,334},
+	{0x895f,130},{0x897f,331},{0x8981,348},{0x8986,85},{0x89c1,126},
+	{0x89c2,100},{0x89c4,102},{0x89c5,190},{0x89c6,285},{0x89c8,158},
+	{0x89c9,136},{0x89d2,128},{0x89e3,129},{0x89e6,39},{0x8a00,346},
+	{0x8a79,371},{0x8a89,356},{0x8a8a,309},{0x8a93,285},{0x8b66,131},
+	{0x8b6c,233},{0x8ba1,124},{0x8ba2,65},{0x8ba3,85},{0x8ba4,259},
+	{0x8ba5,124},{0x8ba8,307},{0x8ba9,256},{0x8bab,241},{0x8bad,344},
+	{0x8bae,350},{0x8baf,344},{0x8bb0,124},{0x8bb2,127},{0x8bb3,121},
+	{0x8bb6,345},{0x8bb8,341},{0x8bb9,74},{0x8bba,179},{0x8bbc,296},
+	{0x8bbd,82},{0x8bbe,282},{0x8bbf,79},{0x8bc0,136},{0x8bc1,376},
+	{0x8bc4,238},{0x8bc5,391},{0x8bc6,285},{0x8bc8,369},{0x8bc9,298},
+	{0x8bca,375},{0x8bcc,379},{0x8bcd,46},{0x8bd1,350},{0x8bd5,285},
+	{0x8bd7,285},{0x8bda,35},{0x8bdb,380},{0x8bdd,117},{0x8bde,56},
+	{0x8be1,102},{0x8be2,344},{0x8be3,350},{0x8be5,87},{0x8be6,334},
+	{0x8be7,28},{0x8beb,129},{0x8bec,330},{0x8bed,356},{0x8bef,330},
+	{0x8bf1,355},{0x8bf2,121},{0x8bf4,294},{0x8bf5,296},{0x8bf7,248},
+	{0x8bf8,380},{0x8bfa,222},{0x8bfb,69},{0x8bfd,80},{0x8bfe,143},
+	{0x8c01,292},{0x8c03,63},{0x8c05,167},{0x8c06,386},{0x8c08,305},
+	{0x8c0a,350},{0x8c0b,198},{0x8c0d,64},{0x8c0e,120},{0x8c10,336},
+	{0x8c13,326},{0x8c17,30},{0x8c1a,346},{0x8c1c,190},{0x8c22,336},
+	{0x8c23,348},{0x8c24,8},{0x8c26,243},{0x8c28,130},{0x8c29,183},
+	{0x8c2c,196},{0x8c2d,305},{0x8c30,158},{0x8c31,240},{0x8c34,243},
+	{0x8c37,97},{0x8c41,123},{0x8c46,68},{0x8c4c,324},{0x8c61,334},
+	{0x8c62,119},{0x8c6a,109},{0x8c6b,356},{0x8c79,9},{0x8c7a,29},
+	{0x8c89,110},{0x8c8c,185},{0x8d1d,10},{0x8d1e,375},{0x8d1f,85},
+	{0x8d21,95},{0x8d22,22},{0x8d23,365},{0x8d24,333},{0x8d25,6},
+	{0x8d26,372},{0x8d27,123},{0x8d28,377},{0x8d29,78},{0x8d2a,305},
+	{0x8d2b,237},{0x8d2c,14},{0x8d2d,96},{0x8d2e,380},{0x8d2f,100},
+	{0x8d30,76},{0x8d31,126},{0x8d34,313},{0x8d35,102},{0x8d37,55},
+	{0x8d38,185},{0x8d39,80},{0x8d3a,110},{0x8d3c,366},{0x8d3e,125},
+	{0x8d3f,121},{0x8d41,170},{0x8d42,175},{0x8d43,363},{0x8d44,388},
+	{0x8d4a,282},{0x8d4b,85},{0x8d4c,69},{0x8d4e,287},{0x8d4f,280},
+	{0x8d50,46},{0x8d54,230},{0x8d56,157},{0x8d58,385},{0x8d5a,383},
+	{0x8d5b,270},{0x8d5e,362},{0x8d60,368},{0x8d61,279},{0x8d62,352},
+	{0x8d63,88},{0x8d64,36},{0x8d66,282},{0x8d6b,110},{0x8d70,390},
+	{0x8d74,85},{0x8d75,373},{0x8d76,88},{0x8d77,241},{0x8d81,34},
+	{0x8d85,32},{0x8d8a,358},{0x8d8b,251},{0x8d9f,306},{0x8da3,251},
+	{0x8db3,391},{0x8db4,225},{0x8dbe,377},{0x8dc3,358},{0x8dcb,5},
+	{0x8dcc,64},{0x8dd1,229},{0x8ddd,134},{0x8ddf,93},{0x8de8,149},
+	{0x8dea,102},{0x8def,175},{0x8df3,312},{0x8df5,126},{0x8dfa,73},
+	{0x8e0a,354},{0x8e0c,38},{0x8e0f,303},{0x8e1e,134},{0x8e22,310},
+	{0x8e29,22},{0x8e2a,389},{0x8e44,310},{0x8e48,58},{0x8e4b,303},
+	{0x8e66,12},{0x8e6c,60},{0x8e6d,27},{0x8e72,72},{0x8e7f,50},
+	{0x8e81,364},{0x8e87,39},{0x8eab,283},{0x8eac,95},{0x8eaf,251},
+	{0x8eb2,73},{0x8eba,306},{0x8f66,33},{0x8f67,369},{0x8f68,102},
+	{0x8f69,342},{0x8f6c,383},{0x8f6e,179},{0x8f6f,265},{0x8f70,114},
+	{0x8f74,379},{0x8f7b,248},{0x8f7d,361},{0x8f7f,128},{0x8f83,128},
+	{0x8f85,85},{0x8f86,167},{0x8f88,10},{0x8f89,121},{0x8f8a,103},
+	{0x8f90,85},{0x8f91,124},{0x8f93,287},{0x8f95,357},{0x8f96,332},
+	{0x8f97,371},{0x8f99,374},{0x8f9b,337},{0x8f9c,97},{0x8f9e,46},
+	{0x8f9f,13},{0x8fa3,156},{0x8fa8,14},{0x8fa9,14},{0x8fab,14},
+	{0x8fb0,34},{0x8fb1,264},{0x8fb9,14},{0x8fbd,168},{0x8fbe,54},
+	{0x8fc1,243},{0x8fc2,356},{0x8fc4,241},{0x8fc5,344},{0x8fc7,104},
+	{0x8fc8,182},{0x8fce,352},{0x8fd0,359},{0x8fd1,130},{0x8fd4,78},
+	{0x8fd8,119},{0x8fd9,374},{0x8fdb,130},{0x8fdc,357},{0x8fdd,326},
+	{0x8fde,166},{0x8fdf,36},{0x8fe2,312},{0x8fea,61},{0x8feb,239},
+	{0x8fed,64},{0x8ff0,287},{0x8ff7,190},{0x8ff8,12},{0x8ff9,124},
+	{0x8ffd,385},{0x9000,319},{0x9001,296},{0x9002,285},{0x9003,307},
+	{0x9006,209},{0x9009,342},{0x900a,344},{0x900f,316},{0x9010,380},
+	{0x9012,61},{0x9014,317},{0x9017,68},{0x901a,315},{0x901b,101},
+	{0x901d,285},{0x901e,35},{0x901f,298},{0x9020,364},{0x9022,82},
+	{0x902e,55},{0x9038,350},{0x903b,180},{0x903c,13},{0x903e,356},
+	{0x9041,72},{0x9042,300},{0x9047,356},{0x904d,14},{0x904f,74},
+	{0x9053,58},{0x9057,350},{0x9063,243},{0x9065,348},{0x906d,364},
+	{0x906e,374},{0x9075,394},{0x907f,13},{0x9080,348},{0x9091,350},
+	{0x9093,60},{0x90a2,338},{0x90a3,200},{0x90a6,8},{0x90aa,336},
+	{0x90ae,355},{0x90af,107},{0x90b1,250},{0x90b5,281},{0x90b9,390},
+	{0x90bb,170},{0x90c1,356},{0x90ca,128},{0x90ce,159},{0x90d1,376},
+	{0x90dd,109},{0x90e1,137},{0x90e7,359},{0x90e8,20},{0x90ed,104},
+	{0x90f4,34},{0x90f8,56},{0x90fd,69},{0x9102,74},{0x9119,13},
+	{0x9149,355},{0x914b,250},{0x914c,387},{0x914d,230},{0x9152,133},
+	{0x9157,341},{0x915a,81},{0x915d,359},{0x915e,304},{0x9163,107},
+	{0x9165,298},{0x916a,160},{0x916c,38},{0x916e,315},{0x9171,127},
+	{0x9175,128},{0x9176,187},{0x9177,148},{0x9178,299},{0x917f,211},
+	{0x9187,44},{0x9189,393},{0x918b,49},{0x9192,338},{0x919a,190},
+	{0x919b,252},{0x91c7,22},{0x91c9,355},{0x91ca,285},{0x91cc,164},
+	{0x91cd,378},{0x91ce,349},{0x91cf,167},{0x91d1,130},{0x91dc,85},
+	{0x9274,126},{0x9488,375},{0x9489,65},{0x948e,243},{0x9492,78},
+	{0x9493,63},{0x9499,87},{0x949d,72},{0x949e,32},{0x949f,378},
+	{0x94a0,200},{0x94a1,10},{0x94a2,89},{0x94a5,358},{0x94a6,247},
+	{0x94a7,137},{0x94a8,330},{0x94a9,96},{0x94ae,216},{0x94b1,243},
+	{0x94b3,243},{0x94b5,19},{0x94bb,392},{0x94be,125},{0x94c0,355},
+	{0x94c1,313},{0x94c2,19},{0x94c3,171},{0x94c5,243},{0x94c6,185},
+	{0x94dc,315},{0x94dd,176},{0x94e1,369},{0x94e3,331},{0x94ec,91},
+	{0x94ed,195},{0x94f0,128},{0x94f1,350},{0x94f2,30},{0x94f6,351},
+	{0x94f8,380},{0x94fa,240},{0x94fe,166},{0x9500,335},{0x9501,302},
+	{0x9504,39},{0x9505,104},{0x9508,340},{0x950b,82},{0x950c,337},
+	{0x9510,266},{0x9511,310},{0x9517,374},{0x9519,53},{0x951a,185},
+	{0x9521,331},{0x9523,180},{0x9524,43},{0x9525,385},{0x9526,130},
+	{0x9528,333},{0x952d,65},{0x952e,126},{0x952f,134},{0x9530,189},
+	{0x9539,245},{0x953b,70},{0x9540,69},{0x9541,187},{0x9547,375},
+	{0x954a,213},{0x954d,213},{0x9550,90},{0x9551,8},{0x955c,131},
+	{0x9563,168},{0x956d,162},{0x9570,166},{0x9576,334},{0x957f,31},
+	{0x95e8,188},{0x95ea,279},{0x95ed,13},{0x95ee,327},{0x95ef,42},
+	{0x95f0,267},{0x95f2,333},{0x95f4,126},{0x95f7,188},{0x95f8,369},
+	{0x95f9,204},{0x95fa,102},{0x95fb,327},{0x95fd,194},{0x9600,77},
+	{0x9601,91},{0x9602,110},{0x9605,358},{0x9609,346},{0x960e,346},
+	{0x9610,30},{0x9611,158},{0x9614,155},{0x961c,85},{0x961f,71},
+	{0x962e,265},{0x9632,79},{0x9633,347},{0x9634,351},{0x9635,375},
+	{0x9636,129},{0x963b,391},{0x963f,0},{0x9640,321},{0x9644,85},
+	{0x9645,124},{0x9646,175},{0x9647,173},{0x9648,34},{0x964b,174},
+	{0x964c,197},{0x964d,127},{0x9650,333},{0x9655,279},{0x965b,13},
+	{0x9661,68},{0x9662,357},{0x9664,39},{0x9668,359},{0x9669,333},
+	{0x966a,230},{0x9675,171},{0x9676,307},{0x9677,333},{0x9685,356},
+	{0x9686,173},{0x968b,300},{0x968f,300},{0x9690,351},{0x9694,91},
+	{0x9698,1},{0x9699,331},{0x969c,372},{0x96a7,300},{0x96b6,164},
+	{0x96be,202},{0x96c0,253},{0x96c1,346},{0x96c4,339},{0x96c5,345},
+	{0x96c6,124},{0x96c7,97},{0x96cc,46},{0x96cd,354},{0x96cf,39},
+	{0x96d5,63},{0x96e8,356},{0x96ea,343},{0x96f6,171},{0x96f7,162},
+	{0x96f9,9},{0x96fe,330},{0x9700,341},{0x9704,335},{0x9707,375},
+	{0x9709,187},{0x970d,123},{0x9713,209},{0x9716,170},{0x971c,291},
+	{0x971e,332},{0x9732,175},{0x9738,5},{0x9739,233},{0x9752,248},
+	{0x9756,131},{0x9759,131},{0x975b,62},{0x975e,80},{0x9760,142},
+	{0x9761,190},{0x9762,191},{0x9769,91},{0x9773,130},{0x9774,343},
+	{0x9776,5},{0x978b,336},{0x978d,2},{0x9798,245},{0x97a0,134},
+	{0x97ad,14},{0x97e6,326},{0x97e7,259},{0x97e9,107},{0x97ed,133},
+	{0x97f3,351},{0x97f5,359},{0x97f6,281},{0x9875,349},{0x9876,65},
+	{0x9877,248},{0x9879,334},{0x987a,293},{0x987b,341},{0x987d,324},
+	{0x987e,97},{0x987f,72},{0x9881,7},{0x9882,296},{0x9884,356},
+	{0x9885,175},{0x9886,171},{0x9887,239},{0x9888,131},{0x988a,125},
+	{0x9890,350},{0x9891,237},{0x9893,319},{0x9896,352},{0x9897,143},
+	{0x9898,310},{0x989c,346},{0x989d,74},{0x98a0,62},{0x98a4,30},
+	{0x98a7,252},{0x98ce,82},{0x98d8,235},{0x98de,80},{0x98df,285},
+	{0x9910,23},{0x9965,124},{0x996d,78},{0x996e,351},{0x996f,126},
+	{0x9970,285},{0x9971,9},{0x9972,295},{0x9975,76},{0x9976,257},
+	{0x997a,128},{0x997c,18},{0x997f,74},{0x9981,206},{0x9985,333},
+	{0x9986,100},{0x9988,153},{0x998b,30},{0x998f,172},{0x9992,183},
+	{0x9996,286},{0x9999,334},{0x9a6c,181},{0x9a6d,356},{0x9a6e,321},
+	{0x9a6f,344},{0x9a70,36},{0x9a71,251},{0x9a73,19},{0x9a74,176},
+	{0x9a76,285},{0x9a79,134},{0x9a7b,380},{0x9a7c,321},{0x9a7e,125},
+	{0x9a82,181},{0x9a84,128},{0x9a86,180},{0x9a87,106},{0x9a8b,35},
+	{0x9a8c,346},{0x9a8f,137},{0x9a91,241},{0x9a97,234},{0x9a9a,273},
+	{0x9aa1,180},{0x9aa4,379},{0x9aa8,97},{0x9ab8,106},{0x9ad3,300},
+	{0x9ad8,90},{0x9b03,389},{0x9b3c,102},{0x9b41,153},{0x9b42,122},
+	{0x9b44,239},{0x9b4f,326},{0x9b54,197},{0x9c7c,356},{0x9c81,175},
+	{0x9c8d,9},{0x9c9c,333},{0x9ca4,164},{0x9cb8,131},{0x9cc3,270},
+	{0x9cd6,16},{0x9cde,170},{0x9e1f,212},{0x9e21,124},{0x9e23,195},
+	{0x9e25,224},{0x9e26,345},{0x9e2d,345},{0x9e2f,347},{0x9e33,357},
+	{0x9e35,321},{0x9e3d,91},{0x9e3f,114},{0x9e43,135},{0x9e45,74},
+	{0x9e4a,253},{0x9e4f,232},{0x9e64,110},{0x9e70,352},{0x9e7f,175},
+	{0x9e93,175},{0x9ea6,182},{0x9ebb,181},{0x9ec4,120},{0x9ecd,287},
+	{0x9ece,164},{0x9ed1,111},{0x9ed4,243},{0x9ed8,197},{0x9f0e,65},
+	{0x9f13,97},{0x9f20,287},{0x9f3b,13},{0x9f50,241},{0x9f7f,36},
+	{0x9f84,171},{0x9f8b,251},{0x9f99,173},{0x9f9a,95},{0x9f9f,102},
+};
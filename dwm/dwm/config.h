@@ -14,6 +14,7 @@ static const unsigned int systrayspacing = 2;   /* systray spacing */
 static const Bool showsystray       = True;     /* False means no systray */
 static const Bool showbar           = True;     /* False means no bar */
 static const Bool topbar            = True;     /* False means bottom bar */
+static const unsigned int framems   = 33;       /* least time between bar repaints */
 
 /* tagging */
 //static const char *tags[] = { "1", "2", "3", "4", "5", "6", "7", "8", "9" };
@@ -50,6 +51,17 @@ static const char *tags[] = { "哆","来","咪","发","索","拉","西","" };
 //static const char *tags[] = { "夜", "来", "风", "雨", "声", "花", "落", "知", "多", "少" };
 //static const char *tags[] = { "日", "暮", "长", "江", "里", "相", "邀", "归", "渡", "头" };
 
+/* status, each block is read again every interval seconds */
+static const char statussep[] = "  ";
+static const Block blocks[] = {
+	/* function     argument                  interval */
+	{ statnet,      "wlan0",                  2 },
+	{ statload,     NULL,                     5 },
+	{ statmemory,   NULL,                     5 },
+	{ statbattery,  "BAT0",                   10 },
+	{ statclock,    "%a %m-%d %H:%M:%S %Z",   1 },
+};
+
 
 static const Rule rules[] = {
 	/* class      instance    title       tags mask     isfloating   monitor */
@@ -92,7 +104,7 @@ static const Layout layouts[] = {
 #define SHCMD(cmd) { .v = (const char*[]){ "/bin/sh", "-c", cmd, NULL } }
 
 /* commands */
-static const char *dmenucmd[] = { "dmenu_run", "-fn", font, "-nb", normbgcolor, "-nf", normfgcolor, "-sb", selbgcolor, "-sf", selfgcolor, NULL };
+static const char *dmenucmd[] = { "dmenu", "-run", "-fn", font, "-nb", normbgcolor, "-nf", normfgcolor, "-sb", selbgcolor, "-sf", selfgcolor, NULL };
 //static const char *termcmd[]  = { "gnome-terminal", NULL };
 static const char *termcmd[]  = { "xterm", NULL };
 //static const char *eccmd[] = { "emacsclient", "-n", "-c", "-a", "", NULL};
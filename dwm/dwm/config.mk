@@ -25,12 +25,16 @@ INCS = -I. -I${X11INC} ${XFTINC}
 LIBS = -lc -L${X11LIB} -lX11 ${XINERAMALIBS} -lXft ${XFTLIBS}
 
 # flags
-CPPFLAGS = -DVERSION=\"${VERSION}\" ${XINERAMAFLAGS}
+CPPFLAGS = -D_GNU_SOURCE -DVERSION=\"${VERSION}\" ${XINERAMAFLAGS}
 #CFLAGS = -g -std=c99 -pedantic -Wall -O0 ${INCS} ${CPPFLAGS}
 CFLAGS = -std=c99 -pedantic -Wall -Os ${INCS} ${CPPFLAGS}
 #LDFLAGS = -g ${LIBS}
 LDFLAGS = -s ${LIBS}
 
+# report the round trips to the server per batch of events on stderr
+#CPPFLAGS += -DROUNDTRIPS
+#LDFLAGS += -rdynamic -ldl
+
 # Solaris
 #CFLAGS = -fast ${INCS} -DVERSION=\"${VERSION}\"
 #LDFLAGS = ${LIBS}
@@ -21,14 +21,21 @@
  * To understand everything else, start reading main().
  */
 #include <errno.h>
+#include <fcntl.h>
 #include <locale.h>
+#include <poll.h>
 #include <stdarg.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/timerfd.h>
 #include <sys/types.h>
+#include <sys/un.h>
 #include <sys/wait.h>
 #include <X11/cursorfont.h>
 #include <X11/keysym.h>
@@ -41,6 +48,9 @@
 #include <X11/extensions/Xinerama.h>
 #endif /* XINERAMA */
 #include <X11/Xft/Xft.h>
+#ifdef ROUNDTRIPS
+#include <dlfcn.h>
+#endif
 
 /* macros */
 #define BUTTONMASK              (ButtonPressMask|ButtonReleaseMask)
@@ -57,6 +67,8 @@
 #define TAGMASK                 ((1 << LENGTH(tags)) - 1)
 #define TEXTW(X)                (textnw(X, strlen(X)) + dc.font.height)
 #define TAGNUM                  (20)
+#define HASHINIT                0xcbf29ce484222325ULL
+#define WINHASH(W)              ((unsigned int)((W) ^ (W) >> 16) * 2654435761u)
 
 #define SYSTEM_TRAY_REQUEST_DOCK    0
 #define _NET_SYSTEM_TRAY_ORIENTATION_HORZ 0
@@ -81,12 +93,14 @@ enum { ColBorder, ColFG, ColBG, ColLast };              /* color */
 enum { NetSupported, NetSystemTray, NetSystemTrayOP, NetSystemTrayOrientation,
 	   NetWMName, NetWMState, NetWMFullscreen, NetActiveWindow, NetWMWindowType,
 	   NetWMWindowTypeDialog, NetLast }; /* EWMH atoms */
-enum { Manager, Xembed, XembedInfo, XLast }; /* Xembed atoms */
+enum { Manager, Xembed, XembedInfo, DWMSelMon, XLast }; /* Xembed and dwm atoms */
 enum { WMProtocols, WMDelete, WMState, WMTakeFocus, WMLast }; /* default atoms */
 //enum { ClkTagBar, ClkLtSymbol, ClkStatusText, ClkWinTitle,
 enum { ClkTagBar, ClkLtSymbol, ClkWinTitle,
 //       ClkWinTitleA, ClkWinTitleS, ClkWinTitleD, ClkWinTitleF, ClkWinTitleG,
        ClkStatusText, ClkClientWin, ClkRootWin, ClkLast };             /* clicks */
+enum { WinEmpty, WinDeleted, WinClient, WinIcon, WinBar };           /* window kinds */
+enum { IpcFocus = 1, IpcTag = 2, IpcTitle = 4, IpcLayout = 8 };      /* ipc events */
 
 typedef union {
 	int i;
@@ -103,6 +117,30 @@ typedef struct {
 	const Arg arg;
 } Button;
 
+typedef struct {
+	int fd;
+	unsigned int events;         /* ipc events subscribed to */
+	size_t len;
+	char buf[512];               /* requests read so far */
+} IpcConn;
+
+typedef struct {
+	int fd[2];                   /* files kept open between updates */
+	unsigned long long last[3];  /* previous counters, for rates */
+	char text[64];
+} BlockState;
+
+typedef struct {
+	void (*func)(const char *arg, BlockState *s);
+	const char *arg;
+	unsigned int interval;       /* seconds */
+} Block;
+
+typedef struct {
+	int x, w;                 /* where it was last drawn, w < 0 if nowhere */
+	unsigned long long key;   /* hash of what it was drawn from */
+} Segment;
+
 typedef struct Monitor Monitor;
 typedef struct Client Client;
 struct Client {
@@ -114,6 +152,7 @@ struct Client {
 	int bw, oldbw;
 	unsigned int tags;
 	Bool isfixed, isfloating, isurgent, neverfocus, oldstate, isfullscreen;
+	unsigned int protocols; /* 1 << WMTakeFocus, 1 << WMDelete, if supported */
 	Client *next;
 	Client *snext;
 	Monitor *mon;
@@ -125,6 +164,7 @@ typedef struct {
 	XftColor norm[ColLast];
 	XftColor sel[ColLast];
 	Drawable drawable;
+	XftDraw *xftdraw;
 	GC gc;
 	struct {
 		int ascent;
@@ -134,6 +174,11 @@ typedef struct {
 	} font;
 } DC; /* draw context */
 
+typedef struct {
+	int w;
+	Pixmap pix[4]; /* normal or selected, plain or urgent */
+} Label;
+
 typedef struct {
 	unsigned int mod;
 	KeySym keysym;
@@ -172,6 +217,14 @@ struct Monitor {
 	Tag mtags[TAGNUM];
 	Monitor *next;
 	Window barwin;
+	Bool dirty;           /* the bar must be repainted */
+	Segment tagseg, ltseg, titleseg, statusseg;
+	unsigned int ntagged[TAGNUM], nurgent[TAGNUM]; /* clients per tag */
+	unsigned int occ, urg; /* tags with clients, with urgent clients */
+	Window ipcsel;        /* what ipcnotify() last reported */
+	unsigned int ipctags;
+	const Layout *ipclt;
+	unsigned long long ipctitle;
 	//const Layout *lt[2];
 };
 
@@ -190,13 +243,21 @@ struct Systray {
 	Client *icons;
 };
 
+typedef struct {
+	Window win;
+	int kind;
+	void *p;       /* the Client for clients and tray icons, Monitor for bars */
+} Win;
+
 /* function declarations */
 static void applyrules(Client *c);
 static Bool applysizehints(Client *c, int *x, int *y, int *w, int *h, Bool interact);
+static void armtimer(void);
 static void arrange(Monitor *m);
 static void arrangemon(Monitor *m);
 static void attach(Client *c);
 static void attachstack(Client *c);
+static int bindsocket(struct sockaddr_un *addr, const char *name, int type);
 static void buttonpress(XEvent *e);
 static void checkotherwm(void);
 static void cleanup(void);
@@ -204,6 +265,7 @@ static void cleanupmon(Monitor *mon);
 static void clearurgent(Client *c);
 static void clientmessage(XEvent *e);
 static void configure(Client *c);
+static void counttags(Client *c, int n);
 static void configurenotify(XEvent *e);
 static void configurerequest(XEvent *e);
 static Monitor *createmon(void);
@@ -231,20 +293,37 @@ static unsigned int getsystraywidth();
 static Bool gettextprop(Window w, Atom atom, char *text, unsigned int size);
 static void grabbuttons(Client *c, Bool focused);
 static void grabkeys(void);
+static unsigned long long hashmem(unsigned long long h, const void *p, size_t n);
+static void ignoreerrors(unsigned long first);
 static void incnmaster(const Arg *arg);
+static void ipcaccept(void);
+static void ipcclose(IpcConn *c);
+static void ipcevent(unsigned int event, const char *fmt, ...);
+static void ipcnotify(void);
+static void ipcread(IpcConn *c);
+static void ipcrequest(IpcConn *c, char *line);
+static void ipcsend(IpcConn *c, const char *fmt, ...);
+static void initblocks(void);
 static void initfont(const char *fontstr);
+static void initlabels(void);
+static void joinstatus(void);
 static void keypress(XEvent *e);
 static void killclient(const Arg *arg);
 static void manage(Window w, XWindowAttributes *wa);
+static void markbar(Monitor *m);
+static void markbars(void);
 static void mappingnotify(XEvent *e);
 static void maprequest(XEvent *e);
 static void monocle(Monitor *m);
 static void motionnotify(XEvent *e);
 static void movemouse(const Arg *arg);
 static Client *nexttiled(Client *c);
+static unsigned int nvisible(Monitor *m);
 static void pop(Client *);
 static void propertynotify(XEvent *e);
 static void quit(const Arg *arg);
+static void readstatussock(void);
+static int readstat(int *fd, const char *path, char *buf, size_t size);
 static Monitor *recttomon(int x, int y, int w, int h);
 static void removesystrayicon(Client *i);
 static void resize(Client *c, int x, int y, int w, int h, Bool interact);
@@ -255,6 +334,7 @@ static void resizerequest(XEvent *e);
 static void restack(Monitor *m);
 static void run(void);
 static void scan(void);
+static Bool segchanged(Segment *s, int x, int w, unsigned long long key);
 static Bool sendevent(Window w, Atom proto, int m, long d0, long d1, long d2, long d3, long d4);
 static void sendmon(Client *c, Monitor *m);
 static void setclientstate(Client *c, long state);
@@ -262,11 +342,18 @@ static void setfocus(Client *c);
 static void setfullscreen(Client *c, Bool fullscreen);
 static void setlayout(const Arg *arg);
 static void setmfact(const Arg *arg);
+static void seturgent(Client *c, Bool urg);
 static void setup(void);
 static void showhide(Client *c);
 static void sigchld(int unused);
 static void spawn(const Arg *arg);
+static void statbattery(const char *arg, BlockState *s);
+static void statclock(const char *arg, BlockState *s);
+static void statload(const char *arg, BlockState *s);
+static void statmemory(const char *arg, BlockState *s);
+static void statnet(const char *arg, BlockState *s);
 static void tag(const Arg *arg);
+static Label *taglabels(Monitor *m);
 static void tagmon(const Arg *arg);
 static int textnw(const char *text, unsigned int len);
 static void tile(Monitor *);
@@ -280,7 +367,10 @@ static void unmapnotify(XEvent *e);
 static Bool updategeom(void);
 static void updatebarpos(Monitor *m);
 static void updatebars(void);
+static void updateblocks(Bool all);
 static void updatenumlockmask(void);
+static void updateprotocols(Client *c);
+static void updateselmon(void);
 static void updatesizehints(Client *c);
 static void updatestatus(void);
 static void updatesystray(void);
@@ -290,11 +380,13 @@ static void updatewindowtype(Client *c);
 static void updatetitle(Client *c);
 static void updatewmhints(Client *c);
 static void view(const Arg *arg);
+static void winadd(Window w, int kind, void *p);
+static void windel(Window w);
+static Win *winfind(Window w);
 static Client *wintoclient(Window w);
 static Monitor *wintomon(Window w);
 static Client *wintosystrayicon(Window w);
 static int xerror(Display *dpy, XErrorEvent *ee);
-static int xerrordummy(Display *dpy, XErrorEvent *ee);
 static int xerrorstart(Display *dpy, XErrorEvent *ee);
 static void zoom(const Arg *arg);
 
@@ -307,6 +399,22 @@ static Systray *systray = NULL;
 static unsigned long systrayorientation = _NET_SYSTEM_TRAY_ORIENTATION_HORZ;
 static const char broken[] = "broken";
 static char stext[256];
+static char rootname[256];                /* the root window name, a segment */
+static int timerfd = -1;                  /* ticks every second for the blocks */
+static int framefd = -1;                  /* fires when the next frame is due */
+static Bool framearmed = False;
+static struct timespec nextframe;         /* no bar repaint before this */
+static int statusfd = -1;                 /* datagrams with status text */
+static struct sockaddr_un statusaddr;
+static struct {
+	char name[16];
+	char text[128];
+} pushed[8];                              /* segments sent to statusfd */
+static unsigned int npushed = 0;
+static int ipcfd = -1;                    /* listens for ipc connections */
+static struct sockaddr_un ipcaddr;
+static IpcConn ipcconns[16];
+static unsigned long long ticks = 0;
 static int screen;
 static int sw, sh;           /* X display screen geometry width, height */
 static int bh, blw = 0;      /* bar geometry */
@@ -336,6 +444,19 @@ static Display *dpy;
 static DC dc;
 static Monitor *mons = NULL, *selmon = NULL;
 static Window root;
+static Bool traydirty = False;
+static unsigned long evserial;   /* first request sent for the current event,
+                                   or since poll() returned */
+static unsigned long enterfirst, enterlast; /* requests whose crossings to ignore */
+static struct {
+	unsigned long first, last;
+} ignored[64];                   /* requests whose errors to ignore */
+static unsigned int ignorepos = 0;
+#ifdef ROUNDTRIPS
+static unsigned long roundtrips = 0;
+#endif
+static Win *wins = NULL;    /* open addressing, every window dwm knows of */
+static unsigned int winscap = 0, winsused = 0, winslive = 0;
 
 /* configuration, allows nested code to access above variables */
 #include "config.h"
@@ -343,6 +464,11 @@ static Window root;
 /* compile-time check if all tags fit into an unsigned int bit array. */
 struct NumTags { char limitexceeded[LENGTH(tags) > 31 ? -1 : 1]; };
 
+static BlockState blockstate[LENGTH(blocks)];
+
+/* tag labels rendered once by initlabels(), first tags then each xtags */
+static Label labels[LENGTH(xtags) + 1][LENGTH(tags)];
+
 /* Modified by dyw */
 static Tag *
 m2t(Monitor *m)
@@ -353,6 +479,20 @@ m2t(Monitor *m)
 	return &m->mtags[i];
 }
 
+#ifdef ROUNDTRIPS
+/* Every request that waits for the server goes through _XReply(), inside
+ * Xlib and Xft as well. Count them on the way to the real one. */
+Status
+_XReply(Display *d, xReply *rep, int extra, Bool discard) {
+	static Status (*xreply)(Display *, xReply *, int, Bool);
+
+	if(!xreply && !(*(void **)&xreply = dlsym(RTLD_NEXT, "_XReply")))
+		die("fatal: cannot find _XReply\n");
+	roundtrips++;
+	return xreply(d, rep, extra, discard);
+}
+#endif
+
 /* function implementations */
 void
 applyrules(Client *c) {
@@ -455,6 +595,20 @@ applysizehints(Client *c, int *x, int *y, int *w, int *h, Bool interact) {
 	return *x != c->x || *y != c->y || *w != c->w || *h != c->h;
 }
 
+/* tick on whole seconds, so that the clock turns with the wall clock.  A
+ * step of the wall clock cancels the timer, and updateblocks() arms it
+ * again, otherwise a step back would hold the ticks off until the clock
+ * caught up. */
+void
+armtimer(void) {
+	struct itimerspec its = { { 1, 0 }, { 0, 0 } };
+
+	clock_gettime(CLOCK_REALTIME, &its.it_value);
+	its.it_value.tv_sec++;
+	its.it_value.tv_nsec = 0;
+	timerfd_settime(timerfd, TFD_TIMER_ABSTIME|TFD_TIMER_CANCEL_ON_SET, &its, NULL);
+}
+
 void
 arrange(Monitor *m) {
 	if(m)
@@ -483,6 +637,7 @@ void
 attach(Client *c) {
 	c->next = c->mon->clients;
 	c->mon->clients = c;
+	counttags(c, 1);
 }
 
 void
@@ -491,6 +646,44 @@ attachstack(Client *c) {
 	c->mon->stack = c;
 }
 
+/* Bind a Unix socket in $XDG_RUNTIME_DIR, or in /tmp with the uid in its
+ * name, that only the user can connect to. */
+int
+bindsocket(struct sockaddr_un *addr, const char *name, int type) {
+	const char *dir = getenv("XDG_RUNTIME_DIR");
+	mode_t mask;
+	int fd;
+
+	addr->sun_family = AF_UNIX;
+	if(dir && dir[0])
+		snprintf(addr->sun_path, sizeof addr->sun_path, "%s/%s", dir, name);
+	else
+		snprintf(addr->sun_path, sizeof addr->sun_path, "/tmp/%s-%u", name, (unsigned int)getuid());
+	if((fd = socket(AF_UNIX, type|SOCK_NONBLOCK|SOCK_CLOEXEC, 0)) < 0) {
+		fprintf(stderr, "dwm: socket: %s\n", strerror(errno));
+		return -1;
+	}
+	unlink(addr->sun_path);
+	/* the socket is created 0600, so nobody else may connect even before
+	 * listen(); in /tmp a socket of someone else is not unlinked and the
+	 * bind fails */
+	mask = umask(S_IXUSR|S_IRWXG|S_IRWXO);
+	if(bind(fd, (struct sockaddr *)addr, sizeof *addr) < 0) {
+		umask(mask);
+		fprintf(stderr, "dwm: bind %s: %s\n", addr->sun_path, strerror(errno));
+		close(fd);
+		return -1;
+	}
+	umask(mask);
+	if(type == SOCK_STREAM && listen(fd, 8) < 0) {
+		fprintf(stderr, "dwm: listen %s: %s\n", addr->sun_path, strerror(errno));
+		close(fd);
+		unlink(addr->sun_path);
+		return -1;
+	}
+	return fd;
+}
+
 void
 buttonpress(XEvent *e) {
 	unsigned int i, x, click;
@@ -508,9 +701,11 @@ buttonpress(XEvent *e) {
 		focus(NULL);
 	}
 	if(ev->window == selmon->barwin) {
+		Label *l = taglabels(selmon);
+
 		i = x = 0;
 		do
-			x += TEXTW(tags[i]);
+			x += l[i].w;
 		while(ev->x >= x && ++i < LENGTH(tags) - 1);
 		if(i < LENGTH(tags) - 1) {
 			click = ClkTagBar;
@@ -524,18 +719,9 @@ buttonpress(XEvent *e) {
 			click = ClkWinTitle;
 			t = m2t(m);
 			if (t->lt - layouts == 2 && ev->button == Button1) {
-				int cn = 0;
+				int cn = MIN(nvisible(selmon), 5);
 				int w;
 				int len = selmon->ww - TEXTW(stext) - x - blw;
-				for (c = selmon->clients; c; c = c->next) {
-					if (ISVISIBLE(c)) {
-						cn++;
-						if (cn > 5) {
-							cn = 5;
-							break;
-						}
-					}
-				}
 				if (cn == 0)
 					return;
 				w = len/cn;
@@ -584,6 +770,7 @@ cleanup(void) {
 	Layout foo = { "", NULL };
 	Monitor *m;
 	Tag *t = m2t(selmon);
+	unsigned int i, j, k;
 
 	view(&a);
 	//selmon->lt[selmon->sellt] = &foo;
@@ -592,6 +779,11 @@ cleanup(void) {
 		while(m->stack)
 			unmanage(m->stack, False);
 	XUngrabKey(dpy, AnyKey, AnyModifier, root);
+	for(i = 0; i < LENGTH(labels); i++)
+		for(j = 0; j < LENGTH(tags); j++)
+			for(k = 0; k < LENGTH(labels[i][j].pix); k++)
+				XFreePixmap(dpy, labels[i][j].pix[k]);
+	XftDrawDestroy(dc.xftdraw);
 	XFreePixmap(dpy, dc.drawable);
 	XFreeGC(dpy, dc.gc);
 	XFreeCursor(dpy, cursor[CurNormal]);
@@ -604,6 +796,27 @@ cleanup(void) {
 		XDestroyWindow(dpy, systray->win);
 		free(systray);
 	}
+	XDeleteProperty(dpy, root, xatom[DWMSelMon]);
+	for(i = 0; i < LENGTH(blocks); i++)
+		for(j = 0; j < LENGTH(blockstate[i].fd); j++)
+			if(blockstate[i].fd[j] >= 0)
+				close(blockstate[i].fd[j]);
+	if(timerfd >= 0)
+		close(timerfd);
+	if(framefd >= 0)
+		close(framefd);
+	if(statusfd >= 0) {
+		close(statusfd);
+		unlink(statusaddr.sun_path);
+	}
+	for(i = 0; i < LENGTH(ipcconns); i++)
+		if(ipcconns[i].fd >= 0)
+			close(ipcconns[i].fd);
+	if(ipcfd >= 0) {
+		close(ipcfd);
+		unlink(ipcaddr.sun_path);
+	}
+	free(wins);
 	XSync(dpy, False);
 	XSetInputFocus(dpy, PointerRoot, RevertToPointerRoot, CurrentTime);
 }
@@ -618,6 +831,7 @@ cleanupmon(Monitor *mon) {
 		for(m = mons; m && m->next != mon; m = m->next);
 		m->next = mon->next;
 	}
+	windel(mon->barwin);
 	XUnmapWindow(dpy, mon->barwin);
 	XDestroyWindow(dpy, mon->barwin);
 	free(mon);
@@ -627,7 +841,7 @@ void
 clearurgent(Client *c) {
 	XWMHints *wmh;
 
-	c->isurgent = False;
+	seturgent(c, False);
 	if(!(wmh = XGetWMHints(dpy, c->win)))
 		return;
 	wmh->flags &= ~XUrgencyHint;
@@ -651,6 +865,7 @@ clientmessage(XEvent *e) {
 			c->mon = selmon;
 			c->next = systray->icons;
 			systray->icons = c;
+			winadd(c->win, WinIcon, c);
 			XGetWindowAttributes(dpy, c->win, &wa);
 			c->x = c->oldx = c->y = c->oldy = 0;
 			c->w = c->oldw = wa.width;
@@ -727,6 +942,7 @@ configurenotify(XEvent *e) {
 			if(dc.drawable != 0)
 				XFreePixmap(dpy, dc.drawable);
 			dc.drawable = XCreatePixmap(dpy, root, sw, bh, DefaultDepth(dpy, screen));
+			XftDrawChange(dc.xftdraw, dc.drawable);
 			updatebars();
 			for(m = mons; m; m = m->next)
 				resizebarwin(m);
@@ -788,7 +1004,24 @@ configurerequest(XEvent *e) {
 		wc.stack_mode = ev->detail;
 		XConfigureWindow(dpy, ev->window, ev->value_mask, &wc);
 	}
-	XSync(dpy, False);
+}
+
+/* Add a client's tags to the counters of its monitor, or with n = -1 take
+ * them away. occ and urg follow the counters. */
+void
+counttags(Client *c, int n) {
+	Monitor *m = c->mon;
+	unsigned int i;
+
+	for(i = 0; i < LENGTH(tags); i++) {
+		if(!(c->tags & 1 << i))
+			continue;
+		m->ntagged[i] += n;
+		if(c->isurgent)
+			m->nurgent[i] += n;
+		m->occ = m->ntagged[i] ? m->occ | 1 << i : m->occ & ~(1 << i);
+		m->urg = m->nurgent[i] ? m->urg | 1 << i : m->urg & ~(1 << i);
+	}
 }
 
 Monitor *
@@ -799,6 +1032,8 @@ createmon(void) {
 	if(!(m = (Monitor *)calloc(1, sizeof(Monitor))))
 		die("fatal: could not malloc() %u bytes\n", sizeof(Monitor));
 	m->tagset[0] = m->tagset[1] = 1;
+	m->dirty = True;
+	m->tagseg.w = m->ltseg.w = m->titleseg.w = m->statusseg.w = -1;
 	for (i = 0; i < TAGNUM; i++) {
 		strncpy(m->mtags[i].ltsymbol, layouts[0].symbol, sizeof m->mtags[i].ltsymbol);
 		m->mtags[i].lt = &layouts[0];
@@ -830,6 +1065,7 @@ detach(Client *c) {
 
 	for(tc = &c->mon->clients; *tc && *tc != c; tc = &(*tc)->next);
 	*tc = c->next;
+	counttags(c, -1);
 }
 
 void
@@ -872,90 +1108,106 @@ dirtomon(int dir) {
 
 void
 drawbar(Monitor *m) {
-	int x;
-	int cn = 0;
-	unsigned int i, occ = 0, urg = 0;
-	const char **ctags;
+	int x, sx, sw;
+	int cn = 0, ntab = 0;
+	unsigned int i, sel, occ = m->occ, urg = m->urg, focused = 0;
+	unsigned long long key;
 	XftColor *col;
-	Client *c;
+	Client *c, *tab[5];
+	Label *l;
 	Tag *t;
 
 	resizebarwin(m);
-	for(c = m->clients; c; c = c->next) {
-		occ |= c->tags;
-		if(c->isurgent)
-			urg |= c->tags;
-	}
+	if(m == selmon && selmon->sel)
+		focused = selmon->sel->tags;
 	dc.x = 0;
 
-	if(m->num < LENGTH(xtags) &&
-	   LENGTH(tags) == LENGTH(xtags[m->num]))
-		ctags = xtags[m->num];
-	else
-		ctags = tags;
-
 	// Do not draw the last tag.
-	for(i = 0; i < LENGTH(tags) - 1; i++) {
-		dc.w = TEXTW(ctags[i]);
-		col = m->tagset[m->seltags] & 1 << i ? dc.sel : dc.norm;
-		drawtext(ctags[i], col, urg & 1 << i);
-		drawsquare(m == selmon && selmon->sel && selmon->sel->tags & 1 << i,
-		           occ & 1 << i, urg & 1 << i, col);
-		dc.x += dc.w;
+	l = taglabels(m);
+	for(x = 0, i = 0; i < LENGTH(tags) - 1; i++)
+		x += l[i].w;
+	key = hashmem(HASHINIT, &m->tagset[m->seltags], sizeof(unsigned int));
+	key = hashmem(key, &occ, sizeof occ);
+	key = hashmem(key, &urg, sizeof urg);
+	key = hashmem(key, &focused, sizeof focused);
+	if(segchanged(&m->tagseg, 0, x, key)) {
+		for(i = 0; i < LENGTH(tags) - 1; i++) {
+			dc.w = l[i].w;
+			sel = m->tagset[m->seltags] & 1 << i;
+			col = sel ? dc.sel : dc.norm;
+			XCopyArea(dpy, l[i].pix[(sel ? 1 : 0) | (urg & 1 << i ? 2 : 0)],
+			          dc.drawable, dc.gc, 0, 0, dc.w, dc.h, dc.x, dc.y);
+			drawsquare(focused & 1 << i, occ & 1 << i, urg & 1 << i, col);
+			dc.x += dc.w;
+		}
+		XCopyArea(dpy, dc.drawable, m->barwin, dc.gc, 0, 0, x, bh, 0, 0);
 	}
+	dc.x = x;
 	t = m2t(m);
 	if (t->lt - layouts == 2) {
-		for (c = selmon->clients; c; c = c->next) {
-			if (ISVISIBLE(c)) {
-				cn++;
-				if (c == m->sel) {
-					i = cn;
-				}
-			}
+		/* one walk finds the tabs and the position of the focused client,
+		 * stopping once it has both */
+		cn = nvisible(selmon);
+		for (c = selmon->clients, i = 0; c && (ntab < 5 || !i); c = c->next) {
+			if (!ISVISIBLE(c))
+				continue;
+			if (ntab < 5)
+				tab[ntab] = c;
+			if (c == m->sel)
+				i = ntab + 1;
+			ntab++;
 		}
-		if (cn == 0)
-			i = 0;
+		ntab = MIN(ntab, 5);
 		snprintf(t->ltsymbol, sizeof t->ltsymbol, "%d:%d", i, cn);
 	}
+	else if (m->sel)
+		tab[ntab++] = m->sel;
 	dc.w = blw = TEXTW(t->ltsymbol);
-	drawtext(t->ltsymbol, dc.norm, False);
-	dc.x += dc.w;
-	x = dc.x;
+	if(segchanged(&m->ltseg, dc.x, dc.w, hashmem(HASHINIT, t->ltsymbol, strlen(t->ltsymbol)))) {
+		drawtext(t->ltsymbol, dc.norm, False);
+		XCopyArea(dpy, dc.drawable, m->barwin, dc.gc, dc.x, 0, dc.w, bh, dc.x, 0);
+	}
+	x += dc.w;
 	if(m == selmon) { /* status is only drawn on selected monitor */
-		dc.w = TEXTW(stext);
-		dc.x = m->ww - dc.w;
+		sw = TEXTW(stext);
+		sx = m->ww - sw;
 		if(showsystray && m == selmon) {
-			dc.x -= getsystraywidth();
+			sx -= getsystraywidth();
 		}
-		if(dc.x < x) {
-			dc.x = x;
-			dc.w = m->ww - x;
+		if(sx < x) {
+			sx = x;
+			sw = m->ww - x;
 		}
-		drawtext(stext, dc.norm, False);
 	}
-	else
-		dc.x = m->ww;
-	if((dc.w = dc.x - x) > bh) {
+	else {
+		sx = m->ww;
+		sw = 0;
+	}
+	if(segchanged(&m->statusseg, sx, sw, hashmem(HASHINIT, stext, strlen(stext))) && sw) {
+		dc.x = sx;
+		dc.w = sw;
+		drawtext(stext, dc.norm, False);
+		XCopyArea(dpy, dc.drawable, m->barwin, dc.gc, sx, 0, sw, bh, sx, 0);
+	}
+	/* the title depends on the focused client, or on every tab in monocle */
+	key = hashmem(HASHINIT, &selmon, sizeof selmon);
+	key = hashmem(key, &m->sel, sizeof m->sel);
+	key = hashmem(key, &t->lt, sizeof t->lt);
+	for(i = 0; i < ntab; i++) {
+		key = hashmem(key, tab[i]->name, strlen(tab[i]->name) + 1);
+		key = hashmem(key, &tab[i]->isfixed, sizeof tab[i]->isfixed);
+		key = hashmem(key, &tab[i]->isfloating, sizeof tab[i]->isfloating);
+	}
+	key = hashmem(key, &cn, sizeof cn);
+	if(segchanged(&m->titleseg, x, sx - x, key) && (dc.w = sx - x) > bh) {
 		dc.x = x;
-		if ((t->lt - layouts == 2) && m->sel) {
+		if ((t->lt - layouts == 2) && m->sel && ntab) {
 			char pname[256+8];
-			dc.w /= (cn > 5 ? 5 : cn);
-			i = 0;
-			for (c = selmon->clients; c; c = c->next) {
-				if (!ISVISIBLE(c))
-					continue;
+			dc.w /= ntab;
+			for (i = 0; i < ntab; i++) {
+				c = tab[i];
 				col = c == m->sel ? dc.sel : dc.norm;
-				i++;
-				if (i > 5)
-					break;
-				switch (i) {
-					case 1: sprintf(pname, "A: %s", c->name); break;
-					case 2: sprintf(pname, "S: %s", c->name); break;
-					case 3: sprintf(pname, "D: %s", c->name); break;
-					case 4: sprintf(pname, "F: %s", c->name); break;
-					case 5: sprintf(pname, "G: %s", c->name); break;
-					default: break;
-				}
+				sprintf(pname, "%c: %s", "ASDFG"[i], c->name);
 				drawtext(pname, col, False);
 				drawsquare(c->isfixed, c->isfloating, False, col);
 				dc.x += dc.w;
@@ -967,18 +1219,50 @@ drawbar(Monitor *m) {
 		}
 		else
 			drawtext(NULL, dc.norm, False);
+		XCopyArea(dpy, dc.drawable, m->barwin, dc.gc, x, 0, sx - x, bh, x, 0);
 	}
-	XCopyArea(dpy, dc.drawable, m->barwin, dc.gc, 0, 0, m->ww, bh, 0, 0);
-	XSync(dpy, False);
 }
 
+/* paint what markbar() and markbars() asked for, once the queue is drained.
+ * Frames are at least framems apart; one asked for sooner is put off until
+ * framefd fires, so a client renaming itself every few milliseconds costs
+ * one repaint per frame. */
 void
 drawbars(void) {
+	struct itimerspec its = { { 0, 0 }, { 0, 0 } };
+	struct timespec now;
 	Monitor *m;
 
+	for(m = mons; m && !m->dirty; m = m->next);
+	if(!m && !traydirty)
+		return;
+	if(framefd >= 0) {
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		if(now.tv_sec < nextframe.tv_sec
+		|| (now.tv_sec == nextframe.tv_sec && now.tv_nsec < nextframe.tv_nsec)) {
+			if(!framearmed) {
+				its.it_value = nextframe;
+				timerfd_settime(framefd, TFD_TIMER_ABSTIME, &its, NULL);
+				framearmed = True;
+			}
+			return;
+		}
+		nextframe.tv_sec = now.tv_sec + framems / 1000;
+		nextframe.tv_nsec = now.tv_nsec + framems % 1000 * 1000000;
+		if(nextframe.tv_nsec >= 1000000000) {
+			nextframe.tv_sec++;
+			nextframe.tv_nsec -= 1000000000;
+		}
+	}
 	for(m = mons; m; m = m->next)
-		drawbar(m);
-	updatesystray();
+		if(m->dirty) {
+			drawbar(m);
+			m->dirty = False;
+		}
+	if(traydirty) {
+		updatesystray();
+		traydirty = False;
+	}
 }
 
 void
@@ -997,7 +1281,6 @@ void
 drawtext(const char *text, XftColor col[ColLast], Bool invert) {
 	char buf[256];
 	int i, x, y, h, len, olen;
-	XftDraw *d;
 
 	XSetForeground(dpy, dc.gc, col[invert ? ColFG : ColBG].pixel);
 	XFillRectangle(dpy, dc.drawable, dc.gc, dc.x, dc.y, dc.w, dc.h);
@@ -1014,11 +1297,7 @@ drawtext(const char *text, XftColor col[ColLast], Bool invert) {
 	memcpy(buf, text, len);
 	if(len < olen)
 		for(i = len; i && i > len - 3; buf[--i] = '.');
-
-	d = XftDrawCreate(dpy, dc.drawable, DefaultVisual(dpy, screen), DefaultColormap(dpy,screen));
-
-	XftDrawStringUtf8(d, &col[invert ? ColBG : ColFG], dc.font.xfont, x, y, (XftChar8 *) buf, len);
-	XftDrawDestroy(d);
+	XftDrawStringUtf8(dc.xftdraw, &col[invert ? ColBG : ColFG], dc.font.xfont, x, y, (XftChar8 *) buf, len);
 }
 
 void
@@ -1027,6 +1306,8 @@ enternotify(XEvent *e) {
 	Monitor *m;
 	XCrossingEvent *ev = &e->xcrossing;
 
+	if(ev->serial >= enterfirst && ev->serial <= enterlast)
+		return; /* the pointer did not move, restack() moved windows under it */
 	if((ev->mode != NotifyNormal || ev->detail == NotifyInferior) && ev->window != root)
 		return;
 	c = wintoclient(ev->window);
@@ -1045,8 +1326,10 @@ expose(XEvent *e) {
 	Monitor *m;
 	XExposeEvent *ev = &e->xexpose;
 
-	if(ev->count == 0 && (m = wintomon(ev->window)))
-		drawbar(m);
+	if(ev->count == 0 && (m = wintomon(ev->window))) {
+		m->tagseg.w = m->ltseg.w = m->titleseg.w = m->statusseg.w = -1;
+		markbar(m);
+	}
 }
 
 void
@@ -1070,7 +1353,8 @@ focus(Client *c) {
 	else
 		XSetInputFocus(dpy, root, RevertToPointerRoot, CurrentTime);
 	selmon->sel = c;
-	drawbars();
+	updateselmon();
+	markbars();
 }
 
 void
@@ -1099,7 +1383,7 @@ focusstackabs(const Arg *arg) {
 	Client *c = NULL;
 	int j = 0;
 
-	if(!selmon->sel)
+	if(!selmon->sel || arg->i < 1 || arg->i > nvisible(selmon))
 		return;
 	for (c = selmon->clients; c; c = c->next) {
 		if (!ISVISIBLE(c))
@@ -1233,7 +1517,6 @@ gettextprop(Window w, Atom atom, char *text, unsigned int size) {
 
 void
 grabbuttons(Client *c, Bool focused) {
-	updatenumlockmask();
 	{
 		unsigned int i, j;
 		unsigned int modifiers[] = { 0, LockMask, numlockmask, numlockmask|LockMask };
@@ -1255,7 +1538,6 @@ grabbuttons(Client *c, Bool focused) {
 
 void
 grabkeys(void) {
-	updatenumlockmask();
 	{
 		unsigned int i, j;
 		unsigned int modifiers[] = { 0, LockMask, numlockmask, numlockmask|LockMask };
@@ -1270,15 +1552,33 @@ grabkeys(void) {
 	}
 }
 
+/* FNV-1a, to tell whether the inputs of a bar segment changed */
+unsigned long long
+hashmem(unsigned long long h, const void *p, size_t n) {
+	const unsigned char *b = p;
+
+	while(n--)
+		h = (h ^ *b++) * 0x100000001b3ULL;
+	return h;
+}
+
+/* Errors caused by the requests sent since first are expected, the window
+ * may be gone already. xerror() drops them when they arrive, so there is
+ * no need to wait for the server here. */
+void
+ignoreerrors(unsigned long first) {
+	if(ignored[ignorepos].last > LastKnownRequestProcessed(dpy))
+		XSync(dpy, False); /* the slot is still needed, rarely happens */
+	ignored[ignorepos].first = first;
+	ignored[ignorepos].last = NextRequest(dpy) - 1;
+	ignorepos = (ignorepos + 1) % LENGTH(ignored);
+}
+
 void
 incnmaster(const Arg *arg) {
-	unsigned int n = 0;
-	Client *c;
+	unsigned int n = nvisible(selmon);
 	Tag *t = m2t(selmon);
 
-	for(c = selmon->clients; c; c = c->next)
-		if(ISVISIBLE(c))
-			n++;
 	if (n == 0)
 		return;
 	//selmon->nmaster = MAX(selmon->nmaster + arg->i, 0);
@@ -1292,6 +1592,240 @@ incnmaster(const Arg *arg) {
 	arrange(selmon);
 }
 
+void
+ipcaccept(void) {
+	struct ucred cred;
+	socklen_t len;
+	unsigned int i;
+	int fd;
+
+	while((fd = accept(ipcfd, NULL, NULL)) >= 0) {
+		/* spawn runs commands, so only our own user may ask */
+		len = sizeof cred;
+		if(getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) < 0 || cred.uid != getuid()) {
+			close(fd);
+			continue;
+		}
+		for(i = 0; i < LENGTH(ipcconns) && ipcconns[i].fd >= 0; i++);
+		if(i == LENGTH(ipcconns)) {
+			close(fd);
+			continue;
+		}
+		fcntl(fd, F_SETFD, FD_CLOEXEC);
+		ipcconns[i].fd = fd;
+		ipcconns[i].events = 0;
+		ipcconns[i].len = 0;
+	}
+}
+
+void
+ipcclose(IpcConn *c) {
+	close(c->fd);
+	c->fd = -1;
+	c->len = 0;
+}
+
+void
+ipcevent(unsigned int event, const char *fmt, ...) {
+	char buf[512];
+	unsigned int i;
+	int n;
+	va_list ap;
+
+	va_start(ap, fmt);
+	n = vsnprintf(buf, sizeof buf, fmt, ap);
+	va_end(ap);
+	if(n >= sizeof buf)
+		buf[(n = sizeof buf - 1) - 1] = '\n';
+	for(i = 0; i < LENGTH(ipcconns); i++)
+		if(ipcconns[i].fd >= 0 && ipcconns[i].events & event
+		&& send(ipcconns[i].fd, buf, n, MSG_DONTWAIT|MSG_NOSIGNAL) != n)
+			ipcclose(&ipcconns[i]); /* a subscriber that does not read */
+}
+
+/* Tell subscribers what changed since the last time the queue was drained. */
+void
+ipcnotify(void) {
+	Monitor *m;
+	Window win;
+	unsigned long long title;
+	Tag *t;
+
+	for(m = mons; m; m = m->next) {
+		t = m2t(m);
+		win = m->sel ? m->sel->win : 0;
+		title = m->sel ? hashmem(HASHINIT, m->sel->name, strlen(m->sel->name)) : 0;
+		if(win != m->ipcsel)
+			ipcevent(IpcFocus, "event focus %d 0x%lx\n", m->num, win);
+		if(m->tagset[m->seltags] != m->ipctags)
+			ipcevent(IpcTag, "event tag %d %u\n", m->num, m->tagset[m->seltags]);
+		if(t->lt != m->ipclt)
+			ipcevent(IpcLayout, "event layout %d %d %s\n", m->num, (int)(t->lt - layouts), t->lt->symbol);
+		if(m->sel && (title != m->ipctitle || win != m->ipcsel))
+			ipcevent(IpcTitle, "event title %d 0x%lx %s\n", m->num, win, m->sel->name);
+		m->ipcsel = win;
+		m->ipctags = m->tagset[m->seltags];
+		m->ipclt = t->lt;
+		m->ipctitle = title;
+	}
+}
+
+void
+ipcread(IpcConn *c) {
+	ssize_t n;
+	char *nl;
+
+	if((n = recv(c->fd, c->buf + c->len, sizeof c->buf - c->len, MSG_DONTWAIT)) <= 0) {
+		if(n == 0 || (errno != EAGAIN && errno != EINTR))
+			ipcclose(c);
+		return;
+	}
+	c->len += n;
+	while(c->fd >= 0 && (nl = memchr(c->buf, '\n', c->len))) {
+		*nl = '\0';
+		ipcrequest(c, c->buf);
+		if(c->fd < 0)
+			return;
+		c->len -= nl + 1 - c->buf;
+		memmove(c->buf, nl + 1, c->len);
+	}
+	if(c->fd >= 0 && c->len == sizeof c->buf) {
+		ipcsend(c, "error request too long\n");
+		ipcclose(c);
+	}
+}
+
+/* One request per line, answered by any number of lines of data and then
+ * "ok" or "error" and the reason. */
+void
+ipcrequest(IpcConn *c, char *line) {
+	static const char *events[] = { "focus", "tag", "title", "layout" };
+	char *argv[8], *end;
+	unsigned int i, j, argc = 0;
+	long n;
+	Arg arg = {0};
+	Client *cl;
+	Monitor *m;
+	Tag *t;
+
+	if(!strncmp(line, "spawn ", 6)) {
+		const char *cmd[] = { "/bin/sh", "-c", line + 6, NULL };
+
+		arg.v = cmd;
+		spawn(&arg);
+		ipcsend(c, "ok\n");
+		return;
+	}
+	for(argv[0] = strtok(line, " \t"); argv[argc] && ++argc < LENGTH(argv); argv[argc] = strtok(NULL, " \t"));
+	if(!argc) {
+		ipcsend(c, "error empty request\n");
+		return;
+	}
+	n = argc > 1 ? strtol(argv[1], &end, 10) : 0;
+	if(!strcmp(argv[0], "view") || !strcmp(argv[0], "tag")) {
+		if(argc != 2 || *end || n < 0 || n >= LENGTH(tags)) {
+			ipcsend(c, "error bad tag\n");
+			return;
+		}
+		arg.ui = 1 << n;
+		(argv[0][0] == 'v' ? view : tag)(&arg);
+	}
+	else if(!strcmp(argv[0], "focusstack")) {
+		if(argc != 2 || *end || !n) {
+			ipcsend(c, "error bad direction\n");
+			return;
+		}
+		arg.i = n;
+		focusstack(&arg);
+	}
+	else if(!strcmp(argv[0], "setlayout")) {
+		if(argc != 2 || *end || n < 0 || n >= LENGTH(layouts)) {
+			ipcsend(c, "error bad layout\n");
+			return;
+		}
+		t = m2t(selmon);
+		t->lt = &layouts[n];
+		strncpy(t->ltsymbol, t->lt->symbol, sizeof t->ltsymbol);
+		if(selmon->sel)
+			arrange(selmon);
+		else
+			markbar(selmon);
+	}
+	else if(!strcmp(argv[0], "setmfact")) {
+		if(argc != 2 || !(arg.f = strtof(argv[1], &end)) || *end) {
+			ipcsend(c, "error bad factor\n");
+			return;
+		}
+		setmfact(&arg);
+	}
+	else if(!strcmp(argv[0], "monitors"))
+		for(m = mons; m; m = m->next)
+			ipcsend(c, "monitor %d %d %d %d %d %u%s\n", m->num, m->mx, m->my, m->mw, m->mh,
+			        m->tagset[m->seltags], m == selmon ? " selected" : "");
+	else if(!strcmp(argv[0], "tags"))
+		for(m = mons; m; m = m->next)
+			for(i = 0; i < LENGTH(tags); i++)
+				ipcsend(c, "tag %d %u %c%c%c %s\n", m->num, i,
+				        m->tagset[m->seltags] & 1 << i ? 'v' : '-',
+				        m->occ & 1 << i ? 'o' : '-', m->urg & 1 << i ? 'u' : '-',
+				        m->num < LENGTH(xtags) && LENGTH(tags) == LENGTH(xtags[0]) ? xtags[m->num][i] : tags[i]);
+	else if(!strcmp(argv[0], "clients"))
+		for(m = mons; m; m = m->next)
+			for(cl = m->clients; cl; cl = cl->next)
+				ipcsend(c, "client 0x%lx %d %u %d %d %d %d %c%c%c %s\n", cl->win, m->num, cl->tags,
+				        cl->x, cl->y, cl->w, cl->h, cl->isfloating ? 'f' : '-',
+				        cl->isfullscreen ? 'F' : '-', cl->isurgent ? 'u' : '-', cl->name);
+	else if(!strcmp(argv[0], "focus"))
+		ipcsend(c, "focus %d 0x%lx\n", selmon->num, selmon->sel ? selmon->sel->win : 0);
+	else if(!strcmp(argv[0], "subscribe")) {
+		for(n = argc == 1 ? IpcFocus|IpcTag|IpcTitle|IpcLayout : 0, i = 1; i < argc; i++) {
+			for(j = 0; j < LENGTH(events) && strcmp(argv[i], events[j]); j++);
+			if(j == LENGTH(events)) {
+				ipcsend(c, "error unknown event %s\n", argv[i]);
+				return;
+			}
+			n |= 1 << j;
+		}
+		c->events = n;
+	}
+	else {
+		ipcsend(c, "error unknown request %s\n", argv[0]);
+		return;
+	}
+	ipcsend(c, "ok\n");
+}
+
+void
+ipcsend(IpcConn *c, const char *fmt, ...) {
+	char buf[512];
+	int n;
+	va_list ap;
+
+	if(c->fd < 0)
+		return;
+	va_start(ap, fmt);
+	n = vsnprintf(buf, sizeof buf, fmt, ap);
+	va_end(ap);
+	if(n >= sizeof buf)
+		buf[(n = sizeof buf - 1) - 1] = '\n';
+	if(send(c->fd, buf, n, MSG_DONTWAIT|MSG_NOSIGNAL) != n)
+		ipcclose(c);
+}
+
+void
+initblocks(void) {
+	unsigned int i;
+
+	for(i = 0; i < LENGTH(blocks); i++)
+		blockstate[i].fd[0] = blockstate[i].fd[1] = -1;
+	if((timerfd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK|TFD_CLOEXEC)) < 0) {
+		fprintf(stderr, "dwm: timerfd_create: %s\n", strerror(errno));
+		return;
+	}
+	armtimer();
+	updateblocks(True);
+}
+
 void
 initfont(const char *fontstr) {
 
@@ -1304,6 +1838,29 @@ initfont(const char *fontstr) {
 	dc.font.height = dc.font.ascent + dc.font.descent;
 }
 
+void
+initlabels(void) {
+	unsigned int i, j, k;
+	const char *text;
+	Drawable drawable = dc.drawable;
+	Label *l;
+
+	dc.x = dc.y = 0;
+	for(i = 0; i < LENGTH(labels); i++)
+		for(j = 0; j < LENGTH(tags); j++) {
+			l = &labels[i][j];
+			text = i && LENGTH(tags) == LENGTH(xtags[i - 1]) ? xtags[i - 1][j] : tags[j];
+			dc.w = l->w = TEXTW(text);
+			for(k = 0; k < LENGTH(l->pix); k++) {
+				dc.drawable = l->pix[k] = XCreatePixmap(dpy, root, dc.w, bh, DefaultDepth(dpy, screen));
+				XftDrawChange(dc.xftdraw, dc.drawable);
+				drawtext(text, k & 1 ? dc.sel : dc.norm, k & 2);
+			}
+		}
+	dc.drawable = drawable;
+	XftDrawChange(dc.xftdraw, dc.drawable);
+}
+
 #ifdef XINERAMA
 static Bool
 isuniquegeom(XineramaScreenInfo *unique, size_t n, XineramaScreenInfo *info) {
@@ -1315,6 +1872,26 @@ isuniquegeom(XineramaScreenInfo *unique, size_t n, XineramaScreenInfo *info) {
 }
 #endif /* XINERAMA */
 
+/* The status is the text of the blocks followed by the pushed segments. */
+void
+joinstatus(void) {
+	unsigned int i, len = 0;
+
+	for(i = 0; i < LENGTH(blocks) && len < sizeof stext; i++)
+		if(blockstate[i].text[0])
+			len += snprintf(stext + len, sizeof stext - len, "%s%s",
+			                len ? statussep : "", blockstate[i].text);
+	for(i = 0; i < npushed && len < sizeof stext; i++)
+		len += snprintf(stext + len, sizeof stext - len, "%s%s",
+		                len ? statussep : "", pushed[i].text);
+	if(rootname[0] && len < sizeof stext)
+		len += snprintf(stext + len, sizeof stext - len, "%s%s",
+		                len ? statussep : "", rootname);
+	if(!len)
+		stext[0] = '\0';
+	markbar(selmon);
+}
+
 void
 keypress(XEvent *e) {
 	unsigned int i;
@@ -1335,13 +1912,13 @@ killclient(const Arg *arg) {
 	if(!selmon->sel)
 		return;
 	if(!sendevent(selmon->sel->win, wmatom[WMDelete], NoEventMask, wmatom[WMDelete], CurrentTime, 0 , 0, 0)) {
+		unsigned long first = NextRequest(dpy);
+
 		XGrabServer(dpy);
-		XSetErrorHandler(xerrordummy);
 		XSetCloseDownMode(dpy, DestroyAll);
 		XKillClient(dpy, selmon->sel->win);
-		XSync(dpy, False);
-		XSetErrorHandler(xerror);
 		XUngrabServer(dpy);
+		ignoreerrors(first);
 	}
 }
 
@@ -1390,8 +1967,8 @@ manage(Window w, XWindowAttributes *wa) {
 	configure(c); /* propagates border_width, if size doesn't change */
 	updatewindowtype(c);
 	updatesizehints(c);
-	updatewmhints(c);
 	XSelectInput(dpy, w, EnterWindowMask|FocusChangeMask|PropertyChangeMask|StructureNotifyMask);
+	updateprotocols(c);
 	grabbuttons(c, False);
 	if(!c->isfloating)
 		c->isfloating = c->oldstate = trans != None || c->isfixed;
@@ -1399,6 +1976,8 @@ manage(Window w, XWindowAttributes *wa) {
 		XRaiseWindow(dpy, c->win);
 	attach(c);
 	attachstack(c);
+	updatewmhints(c); /* once attached, so that urgency is counted */
+	winadd(c->win, WinClient, c);
 	XMoveResizeWindow(dpy, c->win, c->x + 2 * sw, c->y, c->w, c->h); /* some windows require this */
 	setclientstate(c, NormalState);
 	if (c->mon == selmon)
@@ -1412,10 +1991,32 @@ manage(Window w, XWindowAttributes *wa) {
 void
 mappingnotify(XEvent *e) {
 	XMappingEvent *ev = &e->xmapping;
+	Monitor *m;
+	Client *c;
 
 	XRefreshKeyboardMapping(ev);
-	if(ev->request == MappingKeyboard)
+	/* Num_Lock may have moved, so the grabs are made again */
+	if(ev->request == MappingKeyboard || ev->request == MappingModifier) {
+		updatenumlockmask();
 		grabkeys();
+		for(m = mons; m; m = m->next)
+			for(c = m->clients; c; c = c->next)
+				grabbuttons(c, c == selmon->sel);
+	}
+}
+
+void
+markbar(Monitor *m) {
+	m->dirty = True;
+}
+
+void
+markbars(void) {
+	Monitor *m;
+
+	for(m = mons; m; m = m->next)
+		m->dirty = True;
+	traydirty = True;
 }
 
 void
@@ -1439,13 +2040,10 @@ maprequest(XEvent *e) {
 
 void
 monocle(Monitor *m) {
-	unsigned int n = 0;
+	unsigned int n = nvisible(m);
 	Client *c;
 	Tag *t = m2t(m);
 
-	for(c = m->clients; c; c = c->next)
-		if(ISVISIBLE(c))
-			n++;
 	if(n > 0) /* override layout symbol */
 		snprintf(t->ltsymbol, sizeof t->ltsymbol, "[%d]", n);
 	for(c = nexttiled(m->clients); c; c = nexttiled(c->next))
@@ -1532,6 +2130,23 @@ nexttiled(Client *c) {
 	return c;
 }
 
+/* How many clients m shows. A single viewed tag has its count at hand,
+ * only a view of several tags has to walk the clients. */
+unsigned int
+nvisible(Monitor *m) {
+	unsigned int n = 0, i, t = m->tagset[m->seltags];
+	Client *c;
+
+	if(t && !(t & (t - 1))) {
+		for(i = 0; t != 1; t >>= 1, i++);
+		return m->ntagged[i];
+	}
+	for(c = m->clients; c; c = c->next)
+		if(ISVISIBLE(c))
+			n++;
+	return n;
+}
+
 void
 pop(Client *c) {
 	detach(c);
@@ -1573,16 +2188,18 @@ propertynotify(XEvent *e) {
 			break;
 		case XA_WM_HINTS:
 			updatewmhints(c);
-			drawbars();
+			markbars();
 			break;
 		}
 		if(ev->atom == XA_WM_NAME || ev->atom == netatom[NetWMName]) {
 			updatetitle(c);
 			if(c == c->mon->sel)
-				drawbar(c->mon);
+				markbar(c->mon);
 		}
 		if(ev->atom == netatom[NetWMWindowType])
 			updatewindowtype(c);
+		if(ev->atom == wmatom[WMProtocols])
+			updateprotocols(c);
 	}
 }
 
@@ -1591,6 +2208,69 @@ quit(const Arg *arg) {
 	running = False;
 }
 
+/* Read a sysfs or procfs file through a descriptor kept open between calls,
+ * which saves an open() and a close() each time. */
+int
+readstat(int *fd, const char *path, char *buf, size_t size) {
+	ssize_t n;
+
+	if(*fd < 0 && (*fd = open(path, O_RDONLY|O_CLOEXEC)) < 0)
+		return -1;
+	if((n = pread(*fd, buf, size - 1, 0)) < 0) {
+		close(*fd);
+		*fd = -1;
+		return -1;
+	}
+	buf[n] = '\0';
+	return n;
+}
+
+/* Each datagram is "@name text" to set the segment called name, or plain
+ * text to set the unnamed one. Empty text removes the segment. */
+void
+readstatussock(void) {
+	char buf[256], *name, *text;
+	ssize_t n;
+	unsigned int i;
+	Bool changed = False;
+
+	while((n = recv(statusfd, buf, sizeof buf - 1, 0)) >= 0) {
+		buf[n] = '\0';
+		buf[strcspn(buf, "\n")] = '\0';
+		if(buf[0] == '@') {
+			name = buf + 1;
+			text = name + strcspn(name, " ");
+			if(*text)
+				*text++ = '\0';
+		}
+		else {
+			name = "";
+			text = buf;
+		}
+		for(i = 0; i < npushed && strncmp(pushed[i].name, name, sizeof pushed[i].name - 1); i++);
+		if(!text[0]) {
+			if(i < npushed) {
+				memmove(&pushed[i], &pushed[i + 1], (npushed - i - 1) * sizeof pushed[0]);
+				npushed--;
+			}
+		}
+		else {
+			if(i == npushed) {
+				if(npushed == LENGTH(pushed))
+					continue;
+				npushed++;
+				strncpy(pushed[i].name, name, sizeof pushed[i].name - 1);
+				pushed[i].name[sizeof pushed[i].name - 1] = '\0';
+			}
+			strncpy(pushed[i].text, text, sizeof pushed[i].text - 1);
+			pushed[i].text[sizeof pushed[i].text - 1] = '\0';
+		}
+		changed = True;
+	}
+	if(changed)
+		joinstatus();
+}
+
 Monitor *
 recttomon(int x, int y, int w, int h) {
 	Monitor *m, *r = selmon;
@@ -1613,6 +2293,7 @@ removesystrayicon(Client *i) {
 	for(ii = &systray->icons; *ii && *ii != i; ii = &(*ii)->next);
 	if(ii)
 		*ii = i->next;
+	windel(i->win);
 	free(i);
 }
 
@@ -1642,7 +2323,6 @@ resizeclient(Client *c, int x, int y, int w, int h) {
 	wc.border_width = c->bw;
 	XConfigureWindow(dpy, c->win, CWX|CWY|CWWidth|CWHeight|CWBorderWidth, &wc);
 	configure(c);
-	XSync(dpy, False);
 }
 
 void
@@ -1714,11 +2394,10 @@ resizerequest(XEvent *e) {
 void
 restack(Monitor *m) {
 	Client *c;
-	XEvent ev;
 	XWindowChanges wc;
 	Tag *t;
 
-	drawbar(m);
+	markbar(m);
 	if(!m->sel)
 		return;
 	t = m2t(m);
@@ -1735,18 +2414,79 @@ restack(Monitor *m) {
 				wc.sibling = c->win;
 			}
 	}
-	XSync(dpy, False);
-	while(XCheckMaskEvent(dpy, EnterWindowMask, &ev));
+	/* everything sent for this event may have moved a window under the
+	 * pointer, enternotify() skips the crossings it caused */
+	enterfirst = evserial;
+	enterlast = NextRequest(dpy) - 1;
 }
 
 void
 run(void) {
 	XEvent ev;
+	struct pollfd pfd[5 + LENGTH(ipcconns)];
+	unsigned long long n;
+	unsigned int i;
+#ifdef ROUNDTRIPS
+	unsigned int events = 0;
+#endif
+	pfd[0].fd = ConnectionNumber(dpy);
+	pfd[0].events = POLLIN;
+	pfd[1].fd = timerfd; /* ignored by poll() if there is none */
+	pfd[1].events = POLLIN;
+	pfd[2].fd = statusfd;
+	pfd[2].events = POLLIN;
+	pfd[3].fd = ipcfd;
+	pfd[3].events = POLLIN;
+	pfd[4].fd = framefd;
+	pfd[4].events = POLLIN;
+	for(i = 0; i < LENGTH(ipcconns); i++)
+		pfd[5 + i].events = POLLIN;
 	/* main event loop */
 	XSync(dpy, False);
-	while(running && !XNextEvent(dpy, &ev))
+	while(running) {
+		/* XPending() flushes what the handlers queued and reads what
+		 * the server sent, the bars are flushed before waiting */
+		if(!XPending(dpy)) {
+			drawbars();
+			ipcnotify();
+#ifdef ROUNDTRIPS
+			if(events)
+				fprintf(stderr, "dwm: %lu round trips for %u events\n",
+				        roundtrips, events);
+			roundtrips = events = 0;
+#endif
+			XFlush(dpy);
+			for(i = 0; i < LENGTH(ipcconns); i++)
+				pfd[5 + i].fd = ipcconns[i].fd;
+			if(poll(pfd, LENGTH(pfd), -1) < 0) {
+				if(errno != EINTR)
+					die("dwm: poll: %s\n", strerror(errno));
+				continue;
+			}
+			/* the handlers below may restack too */
+			evserial = NextRequest(dpy);
+			if(pfd[1].revents & POLLIN)
+				updateblocks(False);
+			if(pfd[2].revents & POLLIN)
+				readstatussock();
+			if(pfd[3].revents & POLLIN)
+				ipcaccept();
+			if(pfd[4].revents & POLLIN && read(framefd, &n, sizeof n) == sizeof n)
+				framearmed = False;
+			for(i = 0; i < LENGTH(ipcconns); i++)
+				if(pfd[5 + i].revents && ipcconns[i].fd == pfd[5 + i].fd)
+					ipcread(&ipcconns[i]);
+			continue;
+		}
+		if(XNextEvent(dpy, &ev))
+			break;
+#ifdef ROUNDTRIPS
+		events++;
+#endif
+		evserial = NextRequest(dpy);
 		if(handler[ev.type])
 			handler[ev.type](&ev); /* call handler */
+	}
 }
 
 void
@@ -1798,16 +2538,32 @@ setclientstate(Client *c, long state) {
 			PropModeReplace, (unsigned char *)data, 2);
 }
 
+/* Record where a bar segment goes and what it shows, and tell whether that
+ * differs from what barwin has. */
+Bool
+segchanged(Segment *s, int x, int w, unsigned long long key) {
+	if(s->x == x && s->w == w && s->key == key)
+		return False;
+	s->x = x;
+	s->w = w;
+	s->key = key;
+	return True;
+}
+
 Bool
 sendevent(Window w, Atom proto, int mask, long d0, long d1, long d2, long d3, long d4) {
 	int n;
 	Atom *protocols, mt;
 	Bool exists = False;
 	XEvent ev;
+	Client *c;
 
 	if(proto == wmatom[WMTakeFocus] || proto == wmatom[WMDelete]) {
 		mt = wmatom[WMProtocols];
-		if(XGetWMProtocols(dpy, w, &protocols, &n)) {
+		/* managed clients have theirs cached by updateprotocols() */
+		if((c = wintoclient(w)))
+			exists = (c->protocols & 1 << (proto == wmatom[WMDelete] ? WMDelete : WMTakeFocus)) != 0;
+		else if(XGetWMProtocols(dpy, w, &protocols, &n)) {
 			while(!exists && n--)
 				exists = protocols[n] == proto;
 			XFree(protocols);
@@ -1888,7 +2644,7 @@ setlayout(const Arg *arg) {
 	if(selmon->sel)
 		arrange(selmon);
 	else
-		drawbar(selmon);
+		markbar(selmon);
 }
 
 /* arg > 1.0 will set mfact absolutly */
@@ -1907,9 +2663,19 @@ setmfact(const Arg *arg) {
 	arrange(selmon);
 }
 
+void
+seturgent(Client *c, Bool urg) {
+	if(c->isurgent == urg)
+		return;
+	counttags(c, -1);
+	c->isurgent = urg;
+	counttags(c, 1);
+}
+
 void
 setup(void) {
 	XSetWindowAttributes wa;
+	unsigned int i;
 
 	/* clean up any zombies immediately */
 	sigchld(0);
@@ -1940,6 +2706,7 @@ setup(void) {
 	xatom[Manager] = XInternAtom(dpy, "MANAGER", False);
 	xatom[Xembed] = XInternAtom(dpy, "_XEMBED", False);
 	xatom[XembedInfo] = XInternAtom(dpy, "_XEMBED_INFO", False);
+	xatom[DWMSelMon] = XInternAtom(dpy, "_DWM_SELMON", False);
 	/* init cursors */
 	cursor[CurNormal] = XCreateFontCursor(dpy, XC_left_ptr);
 	cursor[CurResize] = XCreateFontCursor(dpy, XC_sizing);
@@ -1952,13 +2719,23 @@ setup(void) {
 	dc.sel[ColBG] = getcolor(selbgcolor);
 	dc.sel[ColFG] = getcolor(selfgcolor);
 	dc.drawable = XCreatePixmap(dpy, root, DisplayWidth(dpy, screen), bh, DefaultDepth(dpy, screen));
+	dc.xftdraw = XftDrawCreate(dpy, dc.drawable, DefaultVisual(dpy, screen), DefaultColormap(dpy, screen));
 	dc.gc = XCreateGC(dpy, root, 0, NULL);
 	XSetLineAttributes(dpy, dc.gc, 1, LineSolid, CapButt, JoinMiter);
+	initlabels();
 	/* init system tray */
 	updatesystray();
 	/* init bars */
 	updatebars();
 	updatestatus();
+	initblocks();
+	framefd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK|TFD_CLOEXEC);
+	/* status producers send datagrams instead of setting the root window
+	 * name, which saves them an X connection and dwm a round trip */
+	statusfd = bindsocket(&statusaddr, "dwm-status", SOCK_DGRAM);
+	for(i = 0; i < LENGTH(ipcconns); i++)
+		ipcconns[i].fd = -1;
+	ipcfd = bindsocket(&ipcaddr, "dwm-ipc", SOCK_STREAM);
 	/* EWMH support per view */
 	XChangeProperty(dpy, root, netatom[NetSupported], XA_ATOM, 32,
 			PropModeReplace, (unsigned char *) netatom, NetLast);
@@ -1968,6 +2745,7 @@ setup(void) {
 	                |EnterWindowMask|LeaveWindowMask|StructureNotifyMask|PropertyChangeMask;
 	XChangeWindowAttributes(dpy, root, CWEventMask|CWCursor, &wa);
 	XSelectInput(dpy, root, wa.event_mask);
+	updatenumlockmask();
 	grabkeys();
 }
 
@@ -2010,15 +2788,106 @@ spawn(const Arg *arg) {
 	}
 }
 
+void
+statbattery(const char *arg, BlockState *s) {
+	char path[128], status[32], capacity[16];
+
+	snprintf(path, sizeof path, "/sys/class/power_supply/%s/status", arg);
+	if(readstat(&s->fd[0], path, status, sizeof status) <= 0) {
+		s->text[0] = '\0';
+		return;
+	}
+	status[strcspn(status, "\n")] = '\0';
+	snprintf(path, sizeof path, "/sys/class/power_supply/%s/capacity", arg);
+	if(readstat(&s->fd[1], path, capacity, sizeof capacity) <= 0)
+		strcpy(capacity, "?");
+	capacity[strcspn(capacity, "\n")] = '\0';
+	snprintf(s->text, sizeof s->text, "%s %s%%", status, capacity);
+}
+
+void
+statclock(const char *arg, BlockState *s) {
+	time_t t = time(NULL);
+	struct tm tm;
+
+	if(!localtime_r(&t, &tm) || !strftime(s->text, sizeof s->text, arg, &tm))
+		s->text[0] = '\0';
+}
+
+void
+statload(const char *arg, BlockState *s) {
+	char buf[128], avg[3][16];
+
+	if(readstat(&s->fd[0], "/proc/loadavg", buf, sizeof buf) <= 0
+	|| sscanf(buf, "%15s %15s %15s", avg[0], avg[1], avg[2]) != 3)
+		s->text[0] = '\0';
+	else
+		snprintf(s->text, sizeof s->text, "%s %s %s", avg[0], avg[1], avg[2]);
+}
+
+void
+statmemory(const char *arg, BlockState *s) {
+	char buf[4096], *p, *q;
+	unsigned long long total, avail;
+
+	if(readstat(&s->fd[0], "/proc/meminfo", buf, sizeof buf) <= 0
+	|| !(p = strstr(buf, "MemTotal:")) || !(q = strstr(buf, "MemAvailable:"))
+	|| sscanf(p, "MemTotal: %llu", &total) != 1 || sscanf(q, "MemAvailable: %llu", &avail) != 1
+	|| !total) {
+		s->text[0] = '\0';
+		return;
+	}
+	snprintf(s->text, sizeof s->text, "mem %llu%%", (total - avail) * 100 / total);
+}
+
+/* bytes per second received and sent since the last call */
+void
+statnet(const char *arg, BlockState *s) {
+	static const char units[] = "BKMG";
+	char path[128], buf[32];
+	unsigned long long bytes[2], rate[2], now;
+	unsigned int i, u[2];
+	struct timespec ts;
+
+	for(i = 0; i < 2; i++) {
+		snprintf(path, sizeof path, "/sys/class/net/%s/statistics/%s_bytes", arg, i ? "tx" : "rx");
+		if(readstat(&s->fd[i], path, buf, sizeof buf) <= 0) {
+			s->text[0] = '\0';
+			s->last[2] = 0;
+			return;
+		}
+		bytes[i] = strtoull(buf, NULL, 10);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	now = ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000;
+	for(i = 0; i < 2; i++) {
+		rate[i] = s->last[2] && now > s->last[2] && bytes[i] >= s->last[i]
+		        ? (bytes[i] - s->last[i]) * 1000 / (now - s->last[2]) : 0;
+		for(u[i] = 0; rate[i] >= 1024 && u[i] < LENGTH(units) - 2; u[i]++)
+			rate[i] /= 1024;
+		s->last[i] = bytes[i];
+	}
+	s->last[2] = now;
+	snprintf(s->text, sizeof s->text, "rx %llu%c tx %llu%c",
+	         rate[0], units[u[0]], rate[1], units[u[1]]);
+}
+
 void
 tag(const Arg *arg) {
 	if(selmon->sel && arg->ui & TAGMASK) {
+		counttags(selmon->sel, -1);
 		selmon->sel->tags = arg->ui & TAGMASK;
+		counttags(selmon->sel, 1);
 		focus(NULL);
 		arrange(selmon);
 	}
 }
 
+Label *
+taglabels(Monitor *m) {
+	return labels[m->num < LENGTH(xtags) ? m->num + 1 : 0];
+}
+
 void
 tagmon(const Arg *arg) {
 	if(!selmon->sel || !mons->next)
@@ -2105,7 +2974,9 @@ toggletag(const Arg *arg) {
 		return;
 	newtags = selmon->sel->tags ^ (arg->ui & TAGMASK);
 	if(newtags) {
+		counttags(selmon->sel, -1);
 		selmon->sel->tags = newtags;
+		counttags(selmon->sel, 1);
 		focus(NULL);
 		arrange(selmon);
 	}
@@ -2140,16 +3011,17 @@ unmanage(Client *c, Bool destroyed) {
 	/* The server grab construct avoids race conditions. */
 	detach(c);
 	detachstack(c);
+	windel(c->win);
 	if(!destroyed) {
+		unsigned long first = NextRequest(dpy);
+
 		wc.border_width = c->oldbw;
 		XGrabServer(dpy);
-		XSetErrorHandler(xerrordummy);
 		XConfigureWindow(dpy, c->win, CWBorderWidth, &wc); /* restore border */
 		XUngrabButton(dpy, AnyButton, AnyModifier, c->win);
 		setclientstate(c, WithdrawnState);
-		XSync(dpy, False);
-		XSetErrorHandler(xerror);
 		XUngrabServer(dpy);
+		ignoreerrors(first);
 	}
 	free(c);
 	focus(NULL);
@@ -2193,9 +3065,37 @@ updatebars(void) {
 		                          CWOverrideRedirect|CWBackPixmap|CWEventMask, &wa);
 		XDefineCursor(dpy, m->barwin, cursor[CurNormal]);
 		XMapRaised(dpy, m->barwin);
+		winadd(m->barwin, WinBar, m);
 	}
 }
 
+/* Run the blocks whose interval has passed, or all of them, and rebuild
+ * the status text if any of them changed. */
+void
+updateblocks(Bool all) {
+	unsigned long long n = 0;
+	unsigned int i;
+	Bool changed = False;
+	char old[sizeof blockstate[0].text];
+
+	if(!all && read(timerfd, &n, sizeof n) != sizeof n) {
+		if(errno != ECANCELED)
+			return;
+		armtimer(); /* the wall clock was set, run every block */
+		all = True;
+	}
+	for(i = 0; i < LENGTH(blocks); i++) {
+		if(!all && (ticks + n) / blocks[i].interval == ticks / blocks[i].interval)
+			continue;
+		memcpy(old, blockstate[i].text, sizeof old);
+		blocks[i].func(blocks[i].arg, &blockstate[i]);
+		changed |= strcmp(old, blockstate[i].text) != 0;
+	}
+	ticks += n;
+	if(changed || all)
+		joinstatus();
+}
+
 void
 updatebarpos(Monitor *m) {
 	m->wy = m->my;
@@ -2259,6 +3159,7 @@ updategeom(void) {
 					dirty = True;
 					c = m->clients;
 					m->clients = c->next;
+					counttags(c, -1);
 					detachstack(c);
 					c->mon = mons;
 					attach(c);
@@ -2306,6 +3207,37 @@ updatenumlockmask(void) {
 	XFreeModifiermap(modmap);
 }
 
+void
+updateprotocols(Client *c) {
+	int n;
+	Atom *protocols;
+
+	c->protocols = 0;
+	if(XGetWMProtocols(dpy, c->win, &protocols, &n)) {
+		while(n--)
+			if(protocols[n] == wmatom[WMTakeFocus])
+				c->protocols |= 1 << WMTakeFocus;
+			else if(protocols[n] == wmatom[WMDelete])
+				c->protocols |= 1 << WMDelete;
+		XFree(protocols);
+	}
+}
+
+/* publish the geometry of the selected monitor, so that dmenu need not
+ * search for the focused window to find it */
+void
+updateselmon(void) {
+	static long geom[4];
+	long g[4];
+
+	g[0] = selmon->mx; g[1] = selmon->my; g[2] = selmon->mw; g[3] = selmon->mh;
+	if(!memcmp(g, geom, sizeof g))
+		return;
+	memcpy(geom, g, sizeof g);
+	XChangeProperty(dpy, root, xatom[DWMSelMon], XA_CARDINAL, 32,
+	                PropModeReplace, (unsigned char *)geom, 4);
+}
+
 void
 updatesizehints(Client *c) {
 	long msize;
@@ -2366,9 +3298,9 @@ updatetitle(Client *c) {
 
 void
 updatestatus(void) {
-	if(!gettextprop(root, XA_WM_NAME, stext, sizeof(stext)))
-		strcpy(stext, "dwm-"VERSION);
-	drawbar(selmon);
+	if(!gettextprop(root, XA_WM_NAME, rootname, sizeof rootname))
+		rootname[0] = '\0';
+	joinstatus();
 }
 
 void
@@ -2466,7 +3398,6 @@ updatesystray(void) {
 	w = w ? w + systrayspacing : 1;
  	x -= w;
 	XMoveResizeWindow(dpy, systray->win, x, selmon->by, w, bh);
-	XSync(dpy, False);
 }
 
 void
@@ -2491,7 +3422,7 @@ updatewmhints(Client *c) {
 			XSetWMHints(dpy, c->win, wmh);
 		}
 		else
-			c->isurgent = (wmh->flags & XUrgencyHint) ? True : False;
+			seturgent(c, (wmh->flags & XUrgencyHint) ? True : False);
 		if(wmh->flags & InputHint)
 			c->neverfocus = !wmh->input;
 		else
@@ -2511,42 +3442,89 @@ view(const Arg *arg) {
 	arrange(selmon);
 }
 
+void
+winadd(Window w, int kind, void *p) {
+	Win *e, *old = wins;
+	unsigned int i, n = winscap;
+
+	if((e = winfind(w))) {
+		e->kind = kind;
+		e->p = p;
+		return;
+	}
+	if(2 * (winsused + 1) > winscap) {
+		/* rehash into a table at most a quarter full, which also drops
+		 * the deleted slots */
+		for(winscap = 64; winscap < 4 * (winslive + 1); winscap *= 2);
+		if(!(wins = calloc(winscap, sizeof(Win))))
+			die("fatal: could not malloc() %u bytes\n", winscap * sizeof(Win));
+		winsused = winslive = 0;
+		for(i = 0; i < n; i++)
+			if(old[i].kind > WinDeleted)
+				winadd(old[i].win, old[i].kind, old[i].p);
+		free(old);
+	}
+	for(i = WINHASH(w) & (winscap - 1); wins[i].kind > WinDeleted; i = (i + 1) & (winscap - 1));
+	if(wins[i].kind == WinEmpty)
+		winsused++;
+	winslive++;
+	wins[i].win = w;
+	wins[i].kind = kind;
+	wins[i].p = p;
+}
+
+void
+windel(Window w) {
+	Win *e;
+
+	if((e = winfind(w))) {
+		e->kind = WinDeleted;
+		winslive--;
+	}
+}
+
+Win *
+winfind(Window w) {
+	unsigned int i;
+
+	if(!winscap)
+		return NULL;
+	for(i = WINHASH(w) & (winscap - 1); wins[i].kind != WinEmpty; i = (i + 1) & (winscap - 1))
+		if(wins[i].win == w && wins[i].kind != WinDeleted)
+			return &wins[i];
+	return NULL;
+}
+
 Client *
 wintoclient(Window w) {
-	Client *c;
-	Monitor *m;
+	Win *e = winfind(w);
 
-	for(m = mons; m; m = m->next)
-		for(c = m->clients; c; c = c->next)
-			if(c->win == w)
-				return c;
-	return NULL;
+	return e && e->kind == WinClient ? e->p : NULL;
 }
 
 Monitor *
 wintomon(Window w) {
 	int x, y;
-	Client *c;
-	Monitor *m;
+	Win *e;
 
 	if(w == root && getrootptr(&x, &y))
 		return recttomon(x, y, 1, 1);
-	for(m = mons; m; m = m->next)
-		if(w == m->barwin)
-			return m;
-	if((c = wintoclient(w)))
-		return c->mon;
+	if((e = winfind(w))) {
+		if(e->kind == WinBar)
+			return e->p;
+		if(e->kind == WinClient)
+			return ((Client *)e->p)->mon;
+	}
 	return selmon;
 }
 
 Client *
 wintosystrayicon(Window w) {
-	Client *i = NULL;
+	Win *e;
 
 	if(!showsystray || !w)
-		return i;
-	for(i = systray->icons; i && i->win != w; i = i->next) ;
-	return i;
+		return NULL;
+	return (e = winfind(w)) && e->kind == WinIcon ? e->p : NULL;
 }
 
 /* There's no way to check accesses to destroyed windows, thus those cases are
@@ -2554,6 +3532,11 @@ wintosystrayicon(Window w) {
  * default error handler, which may call exit.  */
 int
 xerror(Display *dpy, XErrorEvent *ee) {
+	unsigned int i;
+
+	for(i = 0; i < LENGTH(ignored); i++)
+		if(ee->serial >= ignored[i].first && ee->serial <= ignored[i].last)
+			return 0;
 	if(ee->error_code == BadWindow
 	|| (ee->request_code == X_SetInputFocus && ee->error_code == BadMatch)
 	|| (ee->request_code == X_PolyText8 && ee->error_code == BadDrawable)
@@ -2569,11 +3552,6 @@ xerror(Display *dpy, XErrorEvent *ee) {
 	return xerrorxlib(dpy, ee); /* may call exit */
 }
 
-int
-xerrordummy(Display *dpy, XErrorEvent *ee) {
-	return 0;
-}
-
 /* Startup Error handler to check if another window manager
  * is already running. */
 int
@@ -2602,37 +3580,23 @@ peertag(const Arg *arg) {
 
 void
 dycycle(const Arg *arg) {
-	Client *c;
-	unsigned int n, t;
-	t = 0;
+	unsigned int t;
 	// direction
 	int dir = 0;
 	if (arg->i >= 0)
 		dir = 1;
-	for (;;) {
+	for (t = 0; t <= LENGTH(tags); t++) {
 		// Only cycle in the tags having clients visiable.
-		if (dir == 1) {
+		if (dir == 1)
 			selmon->tagset[selmon->seltags] <<= 1;
-		}
 		else
 			selmon->tagset[selmon->seltags] >>= 1;
-			selmon->tagset[selmon->seltags] &= TAGMASK;
-			if (selmon->tagset[selmon->seltags] == 0)
-				selmon->tagset[selmon->seltags] = dir == 1 ? 1 : (1 << (LENGTH(tags)-1));
-		n = 0;
-		for(c = selmon->clients; c; c = c->next)
-			if(ISVISIBLE(c)) {
-				n = 1;
-				break;
-			}
-		if (n > 0) {
+		selmon->tagset[selmon->seltags] &= TAGMASK;
+		if (selmon->tagset[selmon->seltags] == 0)
+			selmon->tagset[selmon->seltags] = dir == 1 ? 1 : (1 << (LENGTH(tags)-1));
+		// If there are no clients, cycle to next tag.
+		if (selmon->tagset[selmon->seltags] & selmon->occ)
 			break;
-		} else {
-			t++;
-			// If there are no clients, cycle to next tag.
-			if (t == LENGTH(tags) + 1)
-				break;
-		}
 	}
 	focus(NULL);
 	arrange(selmon);
@@ -0,0 +1,15 @@
+#include <stdio.h>
+#include <string.h>
+#include "draw.h"
+#include "dfa.h"
+int main(int argc, char **argv) {
+	char line[4096];
+	Dfa *re = dfacompile(argv[1], argc > 2);
+	if(!re) { puts("INVALID"); return 0; }
+	while(fgets(line, sizeof line, stdin)) {
+		line[strcspn(line, "\n")] = 0;
+		printf("%d\n", dfamatch(re, line));
+	}
+	dfafree(re);
+	return 0;
+}